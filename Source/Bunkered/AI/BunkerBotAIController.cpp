@@ -0,0 +1,32 @@
+// AI/BunkerBotAIController.cpp
+#include "AI/BunkerBotAIController.h"
+#include "Components/StateTreeAIComponent.h"
+#include "Subsystems/StateTreeSchedulerSubsystem.h"
+
+ABunkerBotAIController::ABunkerBotAIController()
+{
+    StateTreeAI = CreateDefaultSubobject<UStateTreeAIComponent>(TEXT("StateTreeAI"));
+
+    bStartAILogicOnPossess = true;
+
+    // EQS and the cover tasks query from the pawn's location
+    bAttachToPawn = true;
+}
+
+void ABunkerBotAIController::OnPossess(APawn* InPawn)
+{
+    Super::OnPossess(InPawn);
+    UStateTreeSchedulerSubsystem::RegisterPossessed(StateTreeAI, InPawn);
+}
+
+void ABunkerBotAIController::OnUnPossess()
+{
+    UStateTreeSchedulerSubsystem::UnregisterFromWorld(StateTreeAI, /*bRestoreComponentTick=*/true);
+    Super::OnUnPossess();
+}
+
+void ABunkerBotAIController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UStateTreeSchedulerSubsystem::UnregisterFromWorld(StateTreeAI, /*bRestoreComponentTick=*/false);
+    Super::EndPlay(EndPlayReason);
+}
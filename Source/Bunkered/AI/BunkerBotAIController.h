@@ -0,0 +1,31 @@
+// AI/BunkerBotAIController.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIController.h"
+#include "BunkerBotAIController.generated.h"
+
+class UStateTreeAIComponent;
+
+/**
+ * Runs a cover-using StateTree (see BunkerStateTreeUtility) on an ABunkeredCharacter.
+ * Used for headless load tests: bots go through the same cover interface and RPCs as players.
+ */
+UCLASS()
+class BUNKERED_API ABunkerBotAIController : public AAIController
+{
+    GENERATED_BODY()
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="AI", meta=(AllowPrivateAccess="true"))
+    TObjectPtr<UStateTreeAIComponent> StateTreeAI;
+
+public:
+    ABunkerBotAIController();
+
+    UStateTreeAIComponent* GetStateTreeAI() const { return StateTreeAI; }
+
+protected:
+    virtual void OnPossess(APawn* InPawn) override;
+    virtual void OnUnPossess() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+};
@@ -0,0 +1,252 @@
+// AI/BunkerStateTreeUtility.cpp
+#include "AI/BunkerStateTreeUtility.h"
+#include "StateTreeExecutionContext.h"
+#include "AIController.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "GameFramework/Character.h"
+#include "Bunkers/BunkerBase.h"
+#include "Components/BunkerAdvisorComponent.h"
+#include "Components/BunkerCoverComponent.h"
+#include "Interface/BunkerCoverInterface.h"
+#include "Subsystems/PlayerSnapshotSubsystem.h"
+
+namespace BunkerStateTree
+{
+    /** Eye height used for player line-of-sight checks, matches the advisor's exposure traces */
+    constexpr float EyeHeight = 60.f;
+
+    bool CanUseCover(const ACharacter* Character)
+    {
+        return Character && Character->GetClass()->ImplementsInterface(UBunkerCoverInterface::StaticClass());
+    }
+}
+
+EStateTreeRunStatus FStateTreeFindBestCoverTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+    InstanceData.Bunker = nullptr;
+    InstanceData.SlotIndex = INDEX_NONE;
+
+    UBunkerAdvisorComponent* Advisor = InstanceData.Character ? InstanceData.Character->FindComponentByClass<UBunkerAdvisorComponent>() : nullptr;
+    if (!Advisor) return EStateTreeRunStatus::Failed;
+
+    if (InstanceData.bPlayersAreEnemies)
+    {
+        TArray<AActor*, TInlineAllocator<8>> Enemies;
+        if (const FPlayerSnapshot* Snapshot = UPlayerSnapshotSubsystem::GetSnapshot(InstanceData.Character))
+        {
+            for (const FPlayerSnapshotEntry& Player : Snapshot->Players)
+            {
+                APawn* Pawn = Player.Pawn.Get();
+                if (Pawn && Pawn != InstanceData.Character) Enemies.Add(Pawn);
+            }
+        }
+        Advisor->SetKnownEnemies(Enemies);
+    }
+
+    return Advisor->UpdateSuggestionAsync() ? EStateTreeRunStatus::Running : EStateTreeRunStatus::Failed;
+}
+
+EStateTreeRunStatus FStateTreeFindBestCoverTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+    const UBunkerAdvisorComponent* Advisor = InstanceData.Character ? InstanceData.Character->FindComponentByClass<UBunkerAdvisorComponent>() : nullptr;
+    if (!Advisor) return EStateTreeRunStatus::Failed;
+    if (Advisor->IsSuggestionPending()) return EStateTreeRunStatus::Running;
+
+    const FBunkerCandidate Best = Advisor->GetSuggestion();
+    if (!Best.IsValid()) return EStateTreeRunStatus::Failed;
+
+    InstanceData.Bunker = Best.Bunker;
+    InstanceData.SlotIndex = Best.SlotIndex;
+    InstanceData.SlotLocation = Best.SlotTransform.GetLocation();
+    return EStateTreeRunStatus::Succeeded;
+}
+
+#if WITH_EDITOR
+FText FStateTreeFindBestCoverTask::GetDescription(const FGuid& ID, FStateTreeDataView InstanceDataView, const IStateTreeBindingLookup& BindingLookup, EStateTreeNodeFormatting Formatting) const
+{
+    return FText::FromString("<b>Find Best Cover</b>");
+}
+#endif
+
+////////////////////////////////////////////////////////////////////
+
+namespace BunkerStateTree
+{
+    bool GetSlotGoal(const FStateTreeMoveToCoverSlotInstanceData& InstanceData, FVector& OutLocation, float& OutRadius)
+    {
+        const ABunkerBase* Bunker = InstanceData.Bunker;
+        if (!Bunker || InstanceData.SlotIndex < 0 || InstanceData.SlotIndex >= Bunker->GetNumSlots()) return false;
+
+        OutLocation = Bunker->GetSlotWorldTransform(InstanceData.SlotIndex).GetLocation();
+        OutRadius = FMath::Max(InstanceData.AcceptanceRadius, Bunker->GetSlot(InstanceData.SlotIndex).EntryRadius);
+        return true;
+    }
+}
+
+EStateTreeRunStatus FStateTreeMoveToCoverSlotTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+    FVector Goal; float Radius = 0.f;
+    if (!InstanceData.Controller || !BunkerStateTree::GetSlotGoal(InstanceData, Goal, Radius)) return EStateTreeRunStatus::Failed;
+
+    const EPathFollowingRequestResult::Type Result = InstanceData.Controller->MoveToLocation(Goal, Radius, /*bStopOnOverlap=*/true);
+    switch (Result)
+    {
+    case EPathFollowingRequestResult::AlreadyAtGoal: return EStateTreeRunStatus::Succeeded;
+    case EPathFollowingRequestResult::RequestSuccessful: return EStateTreeRunStatus::Running;
+    default: return EStateTreeRunStatus::Failed;
+    }
+}
+
+EStateTreeRunStatus FStateTreeMoveToCoverSlotTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+    FVector Goal; float Radius = 0.f;
+    const APawn* Pawn = InstanceData.Controller ? InstanceData.Controller->GetPawn() : nullptr;
+    if (!Pawn || !BunkerStateTree::GetSlotGoal(InstanceData, Goal, Radius)) return EStateTreeRunStatus::Failed;
+
+    if (FVector::DistSquared2D(Pawn->GetActorLocation(), Goal) <= FMath::Square(Radius))
+    {
+        return EStateTreeRunStatus::Succeeded;
+    }
+
+    // Path following gave up before we got there
+    return InstanceData.Controller->GetMoveStatus() == EPathFollowingStatus::Idle ? EStateTreeRunStatus::Failed : EStateTreeRunStatus::Running;
+}
+
+void FStateTreeMoveToCoverSlotTask::ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+    if (InstanceData.Controller && InstanceData.Controller->GetMoveStatus() != EPathFollowingStatus::Idle)
+    {
+        InstanceData.Controller->StopMovement();
+    }
+}
+
+#if WITH_EDITOR
+FText FStateTreeMoveToCoverSlotTask::GetDescription(const FGuid& ID, FStateTreeDataView InstanceDataView, const IStateTreeBindingLookup& BindingLookup, EStateTreeNodeFormatting Formatting) const
+{
+    return FText::FromString("<b>Move To Cover Slot</b>");
+}
+#endif
+
+////////////////////////////////////////////////////////////////////
+
+EStateTreeRunStatus FStateTreeEnterCoverTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+    ACharacter* Character = InstanceData.Character;
+    UBunkerCoverComponent* Cover = Character ? Character->FindComponentByClass<UBunkerCoverComponent>() : nullptr;
+    ABunkerBase* Bunker = InstanceData.Bunker;
+    if (!Cover || !Bunker || InstanceData.SlotIndex < 0 || InstanceData.SlotIndex >= Bunker->GetNumSlots()) return EStateTreeRunStatus::Failed;
+
+    // Enter exactly the slot that was scored, not whatever is nearest
+    const bool bAlreadyThere = Cover->GetCurrentBunker() == Bunker && Cover->GetCurrentSlot() == InstanceData.SlotIndex;
+    if (!bAlreadyThere && !Cover->TryEnterCover(Bunker, InstanceData.SlotIndex)) return EStateTreeRunStatus::Failed;
+
+    // Bots run on the server, so the cover component has already applied the entry
+    if (!Cover->IsInCover()) return EStateTreeRunStatus::Failed;
+
+    if (InstanceData.bSetStance && BunkerStateTree::CanUseCover(Character))
+    {
+        IBunkerCoverInterface::Execute_SetSlotStance(Character, InstanceData.Stance);
+    }
+    return EStateTreeRunStatus::Succeeded;
+}
+
+#if WITH_EDITOR
+FText FStateTreeEnterCoverTask::GetDescription(const FGuid& ID, FStateTreeDataView InstanceDataView, const IStateTreeBindingLookup& BindingLookup, EStateTreeNodeFormatting Formatting) const
+{
+    return FText::FromString("<b>Enter Cover</b>");
+}
+#endif
+
+////////////////////////////////////////////////////////////////////
+
+EStateTreeRunStatus FStateTreeCoverPeekTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+    InstanceData.Elapsed = 0.f;
+
+    ACharacter* Character = InstanceData.Character;
+    const UBunkerCoverComponent* Cover = Character ? Character->FindComponentByClass<UBunkerCoverComponent>() : nullptr;
+    if (!Cover || !Cover->IsInCover() || !BunkerStateTree::CanUseCover(Character)) return EStateTreeRunStatus::Failed;
+
+    IBunkerCoverInterface::Execute_SlotPeek(Character, InstanceData.Direction, true);
+    return EStateTreeRunStatus::Running;
+}
+
+EStateTreeRunStatus FStateTreeCoverPeekTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+    if (InstanceData.Duration <= 0.f) return EStateTreeRunStatus::Running;
+
+    InstanceData.Elapsed += DeltaTime;
+    return InstanceData.Elapsed >= InstanceData.Duration ? EStateTreeRunStatus::Succeeded : EStateTreeRunStatus::Running;
+}
+
+void FStateTreeCoverPeekTask::ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+    if (BunkerStateTree::CanUseCover(InstanceData.Character))
+    {
+        IBunkerCoverInterface::Execute_SlotPeek(InstanceData.Character, InstanceData.Direction, false);
+    }
+}
+
+#if WITH_EDITOR
+FText FStateTreeCoverPeekTask::GetDescription(const FGuid& ID, FStateTreeDataView InstanceDataView, const IStateTreeBindingLookup& BindingLookup, EStateTreeNodeFormatting Formatting) const
+{
+    return FText::FromString("<b>Cover Peek</b>");
+}
+#endif
+
+////////////////////////////////////////////////////////////////////
+
+bool FStateTreeIsExposedCondition::TestCondition(FStateTreeExecutionContext& Context) const
+{
+    const FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+    const ACharacter* Character = InstanceData.Character;
+    if (!Character) return false;
+
+    const UBunkerCoverComponent* Cover = Character->FindComponentByClass<UBunkerCoverComponent>();
+    bool bExposed = !Cover || !Cover->IsInCover() || Cover->GetExposureState() != EExposureState::Hidden;
+
+    if (!bExposed && InstanceData.bCheckPlayerSight)
+    {
+        if (const FPlayerSnapshot* Snapshot = UPlayerSnapshotSubsystem::GetSnapshot(Character))
+        {
+            const FVector Target = Character->GetActorLocation();
+            for (const FPlayerSnapshotEntry& Player : Snapshot->Players)
+            {
+                const APawn* Pawn = Player.Pawn.Get();
+                if (!Pawn || Pawn == Character) continue;
+
+                FCollisionQueryParams Params(SCENE_QUERY_STAT(BunkerIsExposed), false, Pawn);
+                Params.AddIgnoredActor(Character);
+                const FVector Eye = Player.Location + FVector(0, 0, BunkerStateTree::EyeHeight);
+                if (!Character->GetWorld()->LineTraceTestByChannel(Eye, Target, InstanceData.VisibilityChannel, Params))
+                {
+                    bExposed = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    return InstanceData.bInvert ? !bExposed : bExposed;
+}
+
+#if WITH_EDITOR
+FText FStateTreeIsExposedCondition::GetDescription(const FGuid& ID, FStateTreeDataView InstanceDataView, const IStateTreeBindingLookup& BindingLookup, EStateTreeNodeFormatting Formatting) const
+{
+    return FText::FromString("<b>Is Exposed</b>");
+}
+#endif
@@ -0,0 +1,221 @@
+// AI/BunkerStateTreeUtility.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StateTreeTaskBase.h"
+#include "StateTreeConditionBase.h"
+#include "Types/CoverTypes.h"
+#include "BunkerStateTreeUtility.generated.h"
+
+class ACharacter;
+class AAIController;
+class ABunkerBase;
+
+/**
+ * StateTree tasks and conditions that let AI use the bunker system.
+ * Stance and peek go through IBunkerCoverInterface on the pawn, exactly as player input does; Enter Cover calls
+ * UBunkerCoverComponent::TryEnterCover so the bot takes the slot Find Best Cover scored. Either way bots exercise
+ * the same cover component path as humans.
+ */
+
+/** Instance data for Find Best Cover */
+USTRUCT()
+struct FStateTreeFindBestCoverInstanceData
+{
+    GENERATED_BODY()
+
+    /** Character looking for cover; needs a UBunkerAdvisorComponent */
+    UPROPERTY(EditAnywhere, Category = Context)
+    TObjectPtr<ACharacter> Character;
+
+    /** Treat every player pawn (except ourselves) as an enemy for exposure scoring */
+    UPROPERTY(EditAnywhere, Category = Parameter)
+    bool bPlayersAreEnemies = true;
+
+    UPROPERTY(EditAnywhere, Category = Output)
+    TObjectPtr<ABunkerBase> Bunker;
+
+    UPROPERTY(EditAnywhere, Category = Output)
+    int32 SlotIndex = INDEX_NONE;
+
+    UPROPERTY(EditAnywhere, Category = Output)
+    FVector SlotLocation = FVector::ZeroVector;
+};
+
+/** Scores nearby slots with the advisor (exposure traces run async) and outputs the best one */
+USTRUCT(meta=(DisplayName="Find Best Cover", Category="Bunker"))
+struct FStateTreeFindBestCoverTask : public FStateTreeTaskCommonBase
+{
+    GENERATED_BODY()
+
+    using FInstanceDataType = FStateTreeFindBestCoverInstanceData;
+    virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+
+    virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+    virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
+
+#if WITH_EDITOR
+    virtual FText GetDescription(const FGuid& ID, FStateTreeDataView InstanceDataView, const IStateTreeBindingLookup& BindingLookup, EStateTreeNodeFormatting Formatting = EStateTreeNodeFormatting::Text) const override;
+#endif
+};
+
+////////////////////////////////////////////////////////////////////
+
+/** Instance data for Move To Cover Slot */
+USTRUCT()
+struct FStateTreeMoveToCoverSlotInstanceData
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, Category = Context)
+    TObjectPtr<AAIController> Controller;
+
+    UPROPERTY(EditAnywhere, Category = Input)
+    TObjectPtr<ABunkerBase> Bunker;
+
+    UPROPERTY(EditAnywhere, Category = Input)
+    int32 SlotIndex = INDEX_NONE;
+
+    /** Arrival distance; the slot's entry radius is used if larger */
+    UPROPERTY(EditAnywhere, Category = Parameter, meta=(ClampMin = 0, Units = "cm"))
+    float AcceptanceRadius = 50.f;
+};
+
+/** Pathfinds to a cover slot and succeeds once close enough to enter it */
+USTRUCT(meta=(DisplayName="Move To Cover Slot", Category="Bunker"))
+struct FStateTreeMoveToCoverSlotTask : public FStateTreeTaskCommonBase
+{
+    GENERATED_BODY()
+
+    using FInstanceDataType = FStateTreeMoveToCoverSlotInstanceData;
+    virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+
+    virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+    virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
+    virtual void ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+
+#if WITH_EDITOR
+    virtual FText GetDescription(const FGuid& ID, FStateTreeDataView InstanceDataView, const IStateTreeBindingLookup& BindingLookup, EStateTreeNodeFormatting Formatting = EStateTreeNodeFormatting::Text) const override;
+#endif
+};
+
+////////////////////////////////////////////////////////////////////
+
+/** Instance data for Enter Cover */
+USTRUCT()
+struct FStateTreeEnterCoverInstanceData
+{
+    GENERATED_BODY()
+
+    /** Pawn with a UBunkerCoverComponent */
+    UPROPERTY(EditAnywhere, Category = Context)
+    TObjectPtr<ACharacter> Character;
+
+    /** Slot to enter, usually bound from Find Best Cover */
+    UPROPERTY(EditAnywhere, Category = Input)
+    TObjectPtr<ABunkerBase> Bunker;
+
+    UPROPERTY(EditAnywhere, Category = Input)
+    int32 SlotIndex = INDEX_NONE;
+
+    /** Optional stance to take once in cover */
+    UPROPERTY(EditAnywhere, Category = Parameter)
+    bool bSetStance = false;
+
+    UPROPERTY(EditAnywhere, Category = Parameter, meta=(EditCondition = "bSetStance"))
+    ECoverStance Stance = ECoverStance::Crouch;
+};
+
+/** Enters the given slot (the one Find Best Cover scored) through UBunkerCoverComponent::TryEnterCover */
+USTRUCT(meta=(DisplayName="Enter Cover", Category="Bunker"))
+struct FStateTreeEnterCoverTask : public FStateTreeTaskCommonBase
+{
+    GENERATED_BODY()
+
+    using FInstanceDataType = FStateTreeEnterCoverInstanceData;
+    virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+
+    virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+
+#if WITH_EDITOR
+    virtual FText GetDescription(const FGuid& ID, FStateTreeDataView InstanceDataView, const IStateTreeBindingLookup& BindingLookup, EStateTreeNodeFormatting Formatting = EStateTreeNodeFormatting::Text) const override;
+#endif
+};
+
+////////////////////////////////////////////////////////////////////
+
+/** Instance data for Peek */
+USTRUCT()
+struct FStateTreeCoverPeekInstanceData
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, Category = Context)
+    TObjectPtr<ACharacter> Character;
+
+    UPROPERTY(EditAnywhere, Category = Parameter)
+    EPeekDirection Direction = EPeekDirection::Over;
+
+    /** How long to hold the peek. 0 holds it until the state exits */
+    UPROPERTY(EditAnywhere, Category = Parameter, meta=(ClampMin = 0, Units = "s"))
+    float Duration = 1.f;
+
+    float Elapsed = 0.f;
+};
+
+/** Holds a peek through IBunkerCoverInterface::SlotPeek and releases it on exit */
+USTRUCT(meta=(DisplayName="Cover Peek", Category="Bunker"))
+struct FStateTreeCoverPeekTask : public FStateTreeTaskCommonBase
+{
+    GENERATED_BODY()
+
+    using FInstanceDataType = FStateTreeCoverPeekInstanceData;
+    virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+
+    virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+    virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
+    virtual void ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+
+#if WITH_EDITOR
+    virtual FText GetDescription(const FGuid& ID, FStateTreeDataView InstanceDataView, const IStateTreeBindingLookup& BindingLookup, EStateTreeNodeFormatting Formatting = EStateTreeNodeFormatting::Text) const override;
+#endif
+};
+
+////////////////////////////////////////////////////////////////////
+
+/** Instance data for Is Exposed */
+USTRUCT()
+struct FStateTreeIsExposedConditionInstanceData
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, Category = Context)
+    TObjectPtr<ACharacter> Character;
+
+    /** Also count as exposed if any player has line of sight to us */
+    UPROPERTY(EditAnywhere, Category = Parameter)
+    bool bCheckPlayerSight = true;
+
+    UPROPERTY(EditAnywhere, Category = Parameter)
+    TEnumAsByte<ECollisionChannel> VisibilityChannel = ECC_Visibility;
+
+    /** If true, the condition passes when NOT exposed */
+    UPROPERTY(EditAnywhere, Category = Condition)
+    bool bInvert = false;
+};
+
+/** Passes when the character is out of cover, peeking/exposed, or (optionally) seen by a player */
+USTRUCT(meta=(DisplayName="Is Exposed", Category="Bunker"))
+struct FStateTreeIsExposedCondition : public FStateTreeConditionCommonBase
+{
+    GENERATED_BODY()
+
+    using FInstanceDataType = FStateTreeIsExposedConditionInstanceData;
+    virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+
+    virtual bool TestCondition(FStateTreeExecutionContext& Context) const override;
+
+#if WITH_EDITOR
+    virtual FText GetDescription(const FGuid& ID, FStateTreeDataView InstanceDataView, const IStateTreeBindingLookup& BindingLookup, EStateTreeNodeFormatting Formatting = EStateTreeNodeFormatting::Text) const override;
+#endif
+};
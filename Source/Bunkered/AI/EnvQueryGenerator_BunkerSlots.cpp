@@ -0,0 +1,66 @@
+// AI/EnvQueryGenerator_BunkerSlots.cpp
+#include "AI/EnvQueryGenerator_BunkerSlots.h"
+#include "AI/EnvQueryItemType_BunkerSlot.h"
+#include "EnvironmentQuery/Contexts/EnvQueryContext_Querier.h"
+#include "Subsystems/BunkerSlotSubsystem.h"
+
+#define LOCTEXT_NAMESPACE "EnvQueryGenerator"
+
+UEnvQueryGenerator_BunkerSlots::UEnvQueryGenerator_BunkerSlots()
+{
+    ItemType = UEnvQueryItemType_BunkerSlot::StaticClass();
+    SearchCenter = UEnvQueryContext_Querier::StaticClass();
+    SearchRadius.DefaultValue = 3000.f;
+}
+
+void UEnvQueryGenerator_BunkerSlots::GenerateItems(FEnvQueryInstance& QueryInstance) const
+{
+    const UBunkerSlotSubsystem* Slots = QueryInstance.World ? QueryInstance.World->GetSubsystem<UBunkerSlotSubsystem>() : nullptr;
+    if (!Slots) return;
+
+    UObject* QueryOwner = QueryInstance.Owner.Get();
+    SearchRadius.BindData(QueryOwner, QueryInstance.QueryID);
+    const float RadiusSq = FMath::Square(SearchRadius.GetValue());
+    const AActor* Querier = UEnvQueryItemType_BunkerSlot::GetQuerierOccupant(QueryOwner);
+
+    TArray<FVector> Centers;
+    QueryInstance.PrepareContext(SearchCenter, Centers);
+    if (Centers.Num() == 0) return;
+
+    // Straight scan of the packed location array; no per-slot UObject access unless filtering occupancy
+    const TConstArrayView<FVector> Locations = Slots->GetLocations();
+    for (int32 SlotId = 0; SlotId < Locations.Num(); ++SlotId)
+    {
+        bool bInRange = false;
+        for (const FVector& Center : Centers)
+        {
+            if (FVector::DistSquared(Center, Locations[SlotId]) <= RadiusSq) { bInRange = true; break; }
+        }
+        if (!bInRange || !Slots->IsValidSlot(SlotId)) continue;
+
+        if (bSkipOccupied)
+        {
+            const AActor* Occupant = Slots->GetOccupant(SlotId);
+            if (Occupant && Occupant != Querier) continue;
+        }
+
+        FBunkerSlotItem Item;
+        Item.Location = Locations[SlotId];
+        Item.SlotId = SlotId;
+        QueryInstance.AddItemData<UEnvQueryItemType_BunkerSlot>(Item);
+    }
+}
+
+FText UEnvQueryGenerator_BunkerSlots::GetDescriptionTitle() const
+{
+    return FText::Format(LOCTEXT("BunkerSlotsTitle", "Bunker Slots around {0}"), UEnvQueryTypes::DescribeContext(SearchCenter));
+}
+
+FText UEnvQueryGenerator_BunkerSlots::GetDescriptionDetails() const
+{
+    return FText::Format(LOCTEXT("BunkerSlotsDetails", "radius: {0}{1}"),
+        FText::FromString(SearchRadius.ToString()),
+        bSkipOccupied ? LOCTEXT("SkipOccupied", ", skip occupied") : FText::GetEmpty());
+}
+
+#undef LOCTEXT_NAMESPACE
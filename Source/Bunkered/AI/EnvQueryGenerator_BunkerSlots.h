@@ -0,0 +1,34 @@
+// AI/EnvQueryGenerator_BunkerSlots.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EnvironmentQuery/EnvQueryGenerator.h"
+#include "DataProviders/AIDataProvider.h"
+#include "EnvQueryGenerator_BunkerSlots.generated.h"
+
+/** Emits bunker slots from UBunkerSlotSubsystem within a radius of the context, without tracing or projecting */
+UCLASS(meta=(DisplayName="Bunker Slots"))
+class BUNKERED_API UEnvQueryGenerator_BunkerSlots : public UEnvQueryGenerator
+{
+    GENERATED_BODY()
+
+public:
+    UEnvQueryGenerator_BunkerSlots();
+
+    virtual void GenerateItems(FEnvQueryInstance& QueryInstance) const override;
+
+    virtual FText GetDescriptionTitle() const override;
+    virtual FText GetDescriptionDetails() const override;
+
+protected:
+    /** Slots are gathered around these locations */
+    UPROPERTY(EditDefaultsOnly, Category=Generator)
+    TSubclassOf<UEnvQueryContext> SearchCenter;
+
+    UPROPERTY(EditDefaultsOnly, Category=Generator)
+    FAIDataProviderFloatValue SearchRadius;
+
+    /** Skip slots held by someone other than the querier */
+    UPROPERTY(EditDefaultsOnly, Category=Generator)
+    bool bSkipOccupied = true;
+};
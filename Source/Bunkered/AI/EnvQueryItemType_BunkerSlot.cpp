@@ -0,0 +1,40 @@
+// AI/EnvQueryItemType_BunkerSlot.cpp
+#include "AI/EnvQueryItemType_BunkerSlot.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Pawn.h"
+
+UEnvQueryItemType_BunkerSlot::UEnvQueryItemType_BunkerSlot()
+{
+    ValueSize = sizeof(FBunkerSlotItem);
+}
+
+const FBunkerSlotItem& UEnvQueryItemType_BunkerSlot::GetValue(const uint8* RawData)
+{
+    return GetValueFromMemory<FBunkerSlotItem>(RawData);
+}
+
+void UEnvQueryItemType_BunkerSlot::SetValue(uint8* RawData, const FBunkerSlotItem& Value)
+{
+    SetValueInMemory<FBunkerSlotItem>(RawData, Value);
+}
+
+FVector UEnvQueryItemType_BunkerSlot::GetItemLocation(const uint8* RawData) const
+{
+    return GetValue(RawData).Location;
+}
+
+FString UEnvQueryItemType_BunkerSlot::GetDescription(const uint8* RawData) const
+{
+    const FBunkerSlotItem& Item = GetValue(RawData);
+    return FString::Printf(TEXT("Slot %d (%s)"), Item.SlotId, *Item.Location.ToCompactString());
+}
+
+const AActor* UEnvQueryItemType_BunkerSlot::GetQuerierOccupant(const UObject* QueryOwner)
+{
+    // Slots are occupied by pawns, but queries are usually run by their controllers
+    if (const AController* Controller = Cast<AController>(QueryOwner))
+    {
+        return Controller->GetPawn();
+    }
+    return Cast<AActor>(QueryOwner);
+}
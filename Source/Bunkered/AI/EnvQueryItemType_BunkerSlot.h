@@ -0,0 +1,34 @@
+// AI/EnvQueryItemType_BunkerSlot.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EnvironmentQuery/Items/EnvQueryItemType_VectorBase.h"
+#include "EnvQueryItemType_BunkerSlot.generated.h"
+
+/** EQS item payload: slot location plus its id in UBunkerSlotSubsystem */
+struct FBunkerSlotItem
+{
+    FVector Location = FVector::ZeroVector;
+    int32 SlotId = INDEX_NONE;
+};
+
+/** EQS item type for bunker slots. Behaves like a point for distance/dot tests; slot tests read SlotId. */
+UCLASS()
+class BUNKERED_API UEnvQueryItemType_BunkerSlot : public UEnvQueryItemType_VectorBase
+{
+    GENERATED_BODY()
+
+public:
+    typedef FBunkerSlotItem FValueType;
+
+    UEnvQueryItemType_BunkerSlot();
+
+    static const FBunkerSlotItem& GetValue(const uint8* RawData);
+    static void SetValue(uint8* RawData, const FBunkerSlotItem& Value);
+
+    /** The actor that would occupy a slot for this querier: an AI controller's pawn, otherwise the querier itself */
+    static const AActor* GetQuerierOccupant(const UObject* QueryOwner);
+
+    virtual FVector GetItemLocation(const uint8* RawData) const override;
+    virtual FString GetDescription(const uint8* RawData) const override;
+};
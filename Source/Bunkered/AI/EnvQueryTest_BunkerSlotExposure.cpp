@@ -0,0 +1,38 @@
+// AI/EnvQueryTest_BunkerSlotExposure.cpp
+#include "AI/EnvQueryTest_BunkerSlotExposure.h"
+#include "AI/EnvQueryItemType_BunkerSlot.h"
+#include "Subsystems/BunkerSlotSubsystem.h"
+
+UEnvQueryTest_BunkerSlotExposure::UEnvQueryTest_BunkerSlotExposure()
+{
+    Cost = EEnvTestCost::Low;
+    ValidItemType = UEnvQueryItemType_BunkerSlot::StaticClass();
+    SetWorkOnFloatValues(true);
+
+    // Default: prefer hidden slots
+    ScoringEquation = EEnvTestScoreEquation::InverseLinear;
+}
+
+void UEnvQueryTest_BunkerSlotExposure::RunTest(FEnvQueryInstance& QueryInstance) const
+{
+    const UBunkerSlotSubsystem* Slots = QueryInstance.World ? QueryInstance.World->GetSubsystem<UBunkerSlotSubsystem>() : nullptr;
+    if (!Slots) return;
+
+    UObject* QueryOwner = QueryInstance.Owner.Get();
+    FloatValueMin.BindData(QueryOwner, QueryInstance.QueryID);
+    FloatValueMax.BindData(QueryOwner, QueryInstance.QueryID);
+    const float MinThresholdValue = FloatValueMin.GetValue();
+    const float MaxThresholdValue = FloatValueMax.GetValue();
+
+    for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
+    {
+        const FBunkerSlotItem& Item = UEnvQueryItemType_BunkerSlot::GetValue(QueryInstance.RawData.GetData() + QueryInstance.Items[It.GetIndex()].DataOffset);
+        const float Exposure = Slots->IsValidSlot(Item.SlotId) ? Slots->GetExposure(Item.SlotId) : 1.f;
+        It.SetScore(TestPurpose, FilterType, Exposure, MinThresholdValue, MaxThresholdValue);
+    }
+}
+
+FText UEnvQueryTest_BunkerSlotExposure::GetDescriptionDetails() const
+{
+    return DescribeFloatTestParams();
+}
@@ -0,0 +1,23 @@
+// AI/EnvQueryTest_BunkerSlotExposure.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EnvironmentQuery/EnvQueryTest.h"
+#include "EnvQueryTest_BunkerSlotExposure.generated.h"
+
+/**
+ * Scores bunker slots by the fraction of players [0..1] that can see them, read from the slot store's
+ * time-sliced exposure cache. No traces are issued by the query itself.
+ */
+UCLASS(meta=(DisplayName="Bunker Slot Exposure"))
+class BUNKERED_API UEnvQueryTest_BunkerSlotExposure : public UEnvQueryTest
+{
+    GENERATED_BODY()
+
+public:
+    UEnvQueryTest_BunkerSlotExposure();
+
+    virtual void RunTest(FEnvQueryInstance& QueryInstance) const override;
+
+    virtual FText GetDescriptionDetails() const override;
+};
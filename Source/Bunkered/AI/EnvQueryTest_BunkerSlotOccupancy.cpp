@@ -0,0 +1,45 @@
+// AI/EnvQueryTest_BunkerSlotOccupancy.cpp
+#include "AI/EnvQueryTest_BunkerSlotOccupancy.h"
+#include "AI/EnvQueryItemType_BunkerSlot.h"
+#include "Subsystems/BunkerSlotSubsystem.h"
+
+UEnvQueryTest_BunkerSlotOccupancy::UEnvQueryTest_BunkerSlotOccupancy()
+{
+    Cost = EEnvTestCost::Low;
+    ValidItemType = UEnvQueryItemType_BunkerSlot::StaticClass();
+    SetWorkOnFloatValues(false);
+
+    // Default: keep only free slots
+    TestPurpose = EEnvTestPurpose::Filter;
+    BoolValue.DefaultValue = false;
+}
+
+void UEnvQueryTest_BunkerSlotOccupancy::RunTest(FEnvQueryInstance& QueryInstance) const
+{
+    const UBunkerSlotSubsystem* Slots = QueryInstance.World ? QueryInstance.World->GetSubsystem<UBunkerSlotSubsystem>() : nullptr;
+    if (!Slots) return;
+
+    UObject* QueryOwner = QueryInstance.Owner.Get();
+    BoolValue.BindData(QueryOwner, QueryInstance.QueryID);
+    const bool bWantsOccupied = BoolValue.GetValue();
+    const AActor* Querier = UEnvQueryItemType_BunkerSlot::GetQuerierOccupant(QueryOwner);
+
+    for (FEnvQueryInstance::ItemIterator It(this, QueryInstance); It; ++It)
+    {
+        const FBunkerSlotItem& Item = UEnvQueryItemType_BunkerSlot::GetValue(QueryInstance.RawData.GetData() + QueryInstance.Items[It.GetIndex()].DataOffset);
+
+        // A slot we already hold counts as free for us; tombstoned slots count as occupied
+        bool bOccupied = !Slots->IsValidSlot(Item.SlotId);
+        if (!bOccupied)
+        {
+            const AActor* Occupant = Slots->GetOccupant(Item.SlotId);
+            bOccupied = Occupant && Occupant != Querier;
+        }
+        It.SetScore(TestPurpose, FilterType, bOccupied, bWantsOccupied);
+    }
+}
+
+FText UEnvQueryTest_BunkerSlotOccupancy::GetDescriptionDetails() const
+{
+    return DescribeBoolTestParams(TEXT("occupied"));
+}
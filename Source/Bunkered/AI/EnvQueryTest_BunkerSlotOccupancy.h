@@ -0,0 +1,20 @@
+// AI/EnvQueryTest_BunkerSlotOccupancy.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EnvironmentQuery/EnvQueryTest.h"
+#include "EnvQueryTest_BunkerSlotOccupancy.generated.h"
+
+/** Tests whether a bunker slot is held by someone other than the querier, from the slot store's occupancy data */
+UCLASS(meta=(DisplayName="Bunker Slot Occupied"))
+class BUNKERED_API UEnvQueryTest_BunkerSlotOccupancy : public UEnvQueryTest
+{
+    GENERATED_BODY()
+
+public:
+    UEnvQueryTest_BunkerSlotOccupancy();
+
+    virtual void RunTest(FEnvQueryInstance& QueryInstance) const override;
+
+    virtual FText GetDescriptionDetails() const override;
+};
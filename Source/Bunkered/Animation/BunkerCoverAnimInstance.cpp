@@ -0,0 +1,48 @@
+// Animation/BunkerCoverAnimInstance.cpp
+#include "Animation/BunkerCoverAnimInstance.h"
+#include "Components/BunkerCoverComponent.h"
+#include "GameFramework/Actor.h"
+
+void UBunkerCoverAnimInstance::NativeInitializeAnimation()
+{
+    Super::NativeInitializeAnimation();
+
+    const AActor* Owner = GetOwningActor();
+    CoverComponent = Owner ? Owner->FindComponentByClass<UBunkerCoverComponent>() : nullptr;
+}
+
+void UBunkerCoverAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
+{
+    Super::NativeUpdateAnimation(DeltaSeconds);
+
+    // Copy on the game thread: the component changes in gameplay code that can overlap the worker-thread update
+    if (const UBunkerCoverComponent* Cover = CoverComponent)
+    {
+        bInCover = Cover->IsInCover();
+        Stance = Cover->GetStance();
+        Peek = Cover->GetPeek();
+        Exposure = Cover->GetExposureState();
+    }
+    else
+    {
+        bInCover = false;
+        Peek = EPeekDirection::None;
+        Exposure = EExposureState::Hidden;
+    }
+
+    bIsPeeking = bInCover && Peek != EPeekDirection::None;
+    bIsExposed = bInCover && Exposure != EExposureState::Hidden;
+}
+
+void UBunkerCoverAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+    Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+    const float TargetLean = !bInCover ? 0.f
+        : Peek == EPeekDirection::Left ? -1.f
+        : Peek == EPeekDirection::Right ? 1.f : 0.f;
+    const float TargetOver = (bInCover && Peek == EPeekDirection::Over) ? 1.f : 0.f;
+
+    LeanAlpha = FMath::FInterpTo(LeanAlpha, TargetLean, DeltaSeconds, PeekBlendSpeed);
+    PeekOverAlpha = FMath::FInterpTo(PeekOverAlpha, TargetOver, DeltaSeconds, PeekBlendSpeed);
+}
@@ -0,0 +1,60 @@
+// Animation/BunkerCoverAnimInstance.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimInstance.h"
+#include "Types/CoverTypes.h"
+#include "BunkerCoverAnimInstance.generated.h"
+
+class UBunkerCoverComponent;
+
+/**
+ * Native base for cover AnimBPs. Cover state is copied from the owner's UBunkerCoverComponent on the game thread
+ * in NativeUpdateAnimation and exposed as plain member variables, so the AnimGraph can read them on the fast path.
+ * NativeThreadSafeUpdateAnimation only derives the eased blend alphas from those copies on a worker thread.
+ */
+UCLASS()
+class BUNKERED_API UBunkerCoverAnimInstance : public UAnimInstance
+{
+    GENERATED_BODY()
+
+protected:
+    virtual void NativeInitializeAnimation() override;
+    virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+    virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
+    /** How fast LeanAlpha/PeekOverAlpha follow the peek direction */
+    UPROPERTY(EditDefaultsOnly, Category="Cover", meta=(ClampMin="0.0"))
+    float PeekBlendSpeed = 8.f;
+
+    UPROPERTY(BlueprintReadOnly, Transient, Category="Cover")
+    bool bInCover = false;
+
+    UPROPERTY(BlueprintReadOnly, Transient, Category="Cover")
+    bool bIsPeeking = false;
+
+    UPROPERTY(BlueprintReadOnly, Transient, Category="Cover")
+    bool bIsExposed = false;
+
+    UPROPERTY(BlueprintReadOnly, Transient, Category="Cover")
+    ECoverStance Stance = ECoverStance::Crouch;
+
+    UPROPERTY(BlueprintReadOnly, Transient, Category="Cover")
+    EPeekDirection Peek = EPeekDirection::None;
+
+    UPROPERTY(BlueprintReadOnly, Transient, Category="Cover")
+    EExposureState Exposure = EExposureState::Hidden;
+
+    /** -1 full left lean .. +1 full right lean, eased */
+    UPROPERTY(BlueprintReadOnly, Transient, Category="Cover")
+    float LeanAlpha = 0.f;
+
+    /** 0..1 blend into the over-the-top peek, eased */
+    UPROPERTY(BlueprintReadOnly, Transient, Category="Cover")
+    float PeekOverAlpha = 0.f;
+
+private:
+    /** Cached at init; only read on the game thread */
+    UPROPERTY(Transient)
+    TObjectPtr<const UBunkerCoverComponent> CoverComponent;
+};
@@ -20,10 +20,13 @@ public class Bunkered : ModuleRules
 			"UMG",
 			"SmartObjectsModule",
 			"GameplayBehaviorSmartObjectsModule", 
-			"UnrealEd"
+			"SignificanceManager"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] { });
+		PrivateDependencyModuleNames.AddRange(new string[] { "Json" });
+
+		// Bunker category for the gameplay debugger (compiled out of shipping/test)
+		SetupGameplayDebuggerSupport(Target);
 
 		PublicIncludePaths.AddRange(new string[] {
 			"Bunkered",
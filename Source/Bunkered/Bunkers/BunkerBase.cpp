@@ -2,35 +2,127 @@
 #include "BunkerBase.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SceneComponent.h"
-#include "Components/ArrowComponent.h"
 #include "Engine/Engine.h"
-#include "Misc/DataValidation.h"
+#include "Engine/StaticMesh.h"
+#include "DataAsset/BunkerMetaData.h"
+#include "Subsystems/BunkerArchetypeSubsystem.h"
+#include "Subsystems/BunkerSlotSubsystem.h"
+#include "Subsystems/PaintballSubsystem.h"
+#include "Utility/BunkerProfiling.h"
+#include "Utility/LoggingMacros.h"
 
 #if WITH_EDITOR
-#include "Components/ArrowComponent.h"
-#include "ScopedTransaction.h"
+ABunkerBase::FOnBunkerConstructed ABunkerBase::OnBunkerConstructed;
 #endif
 
-ABunkerBase::ABunkerBase()
+ABunkerBase::ABunkerBase(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
 {
     Root = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
     RootComponent = Root;
 
-    Bunker = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Visual"));
-    Bunker->SetupAttachment(RootComponent);
-    Bunker->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-    Bunker->SetCanEverAffectNavigation(false);
+    // Optional so subclasses that draw their own visuals (field generator) can skip it
+    Bunker = CreateOptionalDefaultSubobject<UStaticMeshComponent>(TEXT("Visual"));
+    if (Bunker)
+    {
+        Bunker->SetupAttachment(RootComponent);
+        Bunker->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+        Bunker->SetCanEverAffectNavigation(false);
+    }
+}
+
+void ABunkerBase::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
+
+    // Archetypes are preloaded with the map; if this one is still streaming, the mesh (and collision) follows shortly.
+    // The archetype always wins at runtime; an instance's own mesh is only kept for types without one.
+    if (Bunker && GetWorld()->IsGameWorld())
+    {
+        ApplyArchetypeMesh(MetaData, Bunker);
+    }
+}
+
+void ABunkerBase::ApplyArchetypeMesh(const UBunkerMetaData* Type, UStaticMeshComponent* Target)
+{
+    if (!Type || !Target || Type->Mesh.IsNull()) return;
+
+    UStaticMesh* Mesh = Type->Mesh.Get();
+    if (!Mesh && GetWorld() && GetWorld()->IsGameWorld())
+    {
+        // Still streaming in with the level's preload: apply it when that lands
+        UBunkerArchetypeSubsystem* Archetypes = GetWorld()->GetSubsystem<UBunkerArchetypeSubsystem>();
+        if (Archetypes && Archetypes->IsLoading())
+        {
+            Archetypes->CallWhenLoaded(FSimpleDelegate::CreateWeakLambda(Target,
+                [this, WeakType = TWeakObjectPtr<const UBunkerMetaData>(Type), Target]()
+                {
+                    if (const UBunkerMetaData* LoadedType = WeakType.Get())
+                    {
+                        ApplyArchetypeMesh(LoadedType, Target);
+                    }
+                }));
+            return;
+        }
+
+        // Not part of the preload (spawned at runtime, streamed sublevel): load now rather than leave cover without collision
+        BUNKER_LOG(LogBunkerCover, Warning, TEXT("%s: archetype %s was not preloaded, loading its mesh synchronously"), *GetName(), *Type->GetName());
+    }
+    if (!Mesh)
+    {
+        Mesh = Type->Mesh.LoadSynchronous();
+    }
+    Target->SetStaticMesh(Mesh);
+}
+
+void ABunkerBase::BeginPlay()
+{
+    Super::BeginPlay();
+
+    // Register our surface so paintball hits on the visual resolve against this bunker type
+    if (UPaintballSubsystem* Paintballs = GetWorld()->GetSubsystem<UPaintballSubsystem>())
+    {
+        Paintballs->RegisterSurfaceComponent(Bunker, Paintballs->RegisterSurface(MetaData));
+    }
+
+    // Publish our slots to the world slot store (EQS, occupancy, cached exposure)
+    if (UBunkerSlotSubsystem* SlotStore = GetWorld()->GetSubsystem<UBunkerSlotSubsystem>())
+    {
+        SlotStore->RegisterBunker(this);
+    }
+}
+
+void ABunkerBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UPaintballSubsystem* Paintballs = GetWorld()->GetSubsystem<UPaintballSubsystem>())
+    {
+        Paintballs->UnregisterSurfaceComponent(Bunker);
+    }
+
+    if (UBunkerSlotSubsystem* SlotStore = GetWorld()->GetSubsystem<UBunkerSlotSubsystem>())
+    {
+        SlotStore->UnregisterBunker(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+const TArray<FCoverSlot>& ABunkerBase::GetSlots() const
+{
+    return (Slots.Num() == 0 && MetaData) ? MetaData->SlotTemplate : Slots;
 }
 
 int32 ABunkerBase::FindClosestValidSlot(const FVector& WorldLocation, float MaxDist, int32& OutExactIndex) const
 {
+    BUNKER_SCOPE_CYCLE_COUNTER(STAT_Bunker_FindClosestValidSlot);
+
     OutExactIndex = INDEX_NONE;
 
     const float MaxDistSq = FMath::Square(MaxDist);
     float BestSq = MaxDistSq;
     int32 BestIdx = INDEX_NONE;
 
-    for (int32 i = 0; i < Slots.Num(); ++i)
+    for (int32 i = 0; i < GetNumSlots(); ++i)
     {
         const FTransform WT = GetSlotWorldTransform(i);
         const float DistSq = FVector::DistSquared(WT.GetLocation(), WorldLocation);
@@ -45,12 +137,45 @@ int32 ABunkerBase::FindClosestValidSlot(const FVector& WorldLocation, float MaxD
     return BestIdx;
 }
 
+int32 ABunkerBase::GetAdjacentSlot(int32 SlotIndex, int32 Delta) const
+{
+    return FMath::Clamp(SlotIndex + Delta, 0, GetNumSlots() - 1);
+}
+
+bool ABunkerBase::IsSlotOwnCover(int32 SlotIndex, const FHitResult& Hit) const
+{
+    return Hit.GetActor() == this;
+}
+
+void ABunkerBase::SetSlotAnchors(TConstArrayView<FTransform> LocalAnchors)
+{
+    LLM_SCOPE_BYTAG(Bunker_Slots);
+
+    Slots.Reset(LocalAnchors.Num());
+    for (const FTransform& Anchor : LocalAnchors)
+    {
+        FCoverSlot& Slot = Slots.AddDefaulted_GetRef();
+        Slot.bUseComponentTransform = false;
+        Slot.LocalAnchor = Anchor;
+    }
+
+    if (HasActorBegunPlay())
+    {
+        if (UBunkerSlotSubsystem* SlotStore = GetWorld()->GetSubsystem<UBunkerSlotSubsystem>())
+        {
+            SlotStore->RegisterBunker(this);
+        }
+    }
+}
+
 FTransform ABunkerBase::GetSlotWorldTransform(int32 SlotIndex) const
 {
-    check(Slots.IsValidIndex(SlotIndex));
-    const FCoverSlot& Slot = Slots[SlotIndex];
+    const TArray<FCoverSlot>& AllSlots = GetSlots();
+    check(AllSlots.IsValidIndex(SlotIndex));
+    const FCoverSlot& Slot = AllSlots[SlotIndex];
 
-    if (Slot.bUseComponentTransform)
+    // Archetype slots are shared across instances, so component references can't apply to them
+    if (Slot.bUseComponentTransform && &AllSlots == &Slots)
     {
         // Resolve the referenced component on this actor
         if (UActorComponent* AC = Slot.SlotPoint.GetComponent(const_cast<ABunkerBase*>(this)))
@@ -66,92 +191,52 @@ FTransform ABunkerBase::GetSlotWorldTransform(int32 SlotIndex) const
     return Slot.LocalAnchor * GetActorTransform();
 }
 
-static void LogEditorNote(const FString& Msg)
-{
-#if !NO_LOGGING
-    UE_LOG(LogTemp, Warning, TEXT("%s"), *Msg);
-#endif
-    if (GEngine)
-    {
-        GEngine->AddOnScreenDebugMessage(-1, 3.f, FColor::Yellow, Msg);
-    }
-}
-
+#if WITH_EDITOR
 void ABunkerBase::OnConstruction(const FTransform& Transform)
 {
     Super::OnConstruction(Transform);
 
-    RebuildSlotsFromChildren(); // always rebuild from Arrow children
-}
-
-
-void ABunkerBase::TagAllArrowChildrenAsSlots()
-{
-    TArray<UArrowComponent*> Arrows;
-    GetComponents<UArrowComponent>(Arrows);
-
-    int32 Tagged = 0;
-    for (UArrowComponent* Arrow : Arrows)
+    // Game worlds get the real mesh in PostInitializeComponents
+    if (!GetWorld() || !GetWorld()->IsGameWorld())
     {
-        if (!Arrow) continue;
-        if (!SlotTag.IsNone() && !Arrow->ComponentHasTag(SlotTag))
-        {
-            Arrow->ComponentTags.Add(SlotTag);
-            ++Tagged;
-        }
+        UpdateArchetypePreview();
     }
 
-    LogEditorNote(FString::Printf(TEXT("[Bunker] Tagged %d Arrow component(s) with %s"), Tagged, *SlotTag.ToString()));
+    // Slot auto-sync from arrow children is handled by BunkeredEditor
+    OnBunkerConstructed.Broadcast(this);
 }
 
-#if WITH_EDITOR
-void ABunkerBase::RebuildSlotsFromChildren()
+void ABunkerBase::UpdateArchetypePreview()
 {
-    UE_LOG(LogTemp, Warning, TEXT("[Bunker] Rebuilding slots from arrow components only."));
-
-    Slots.Empty();
+    const bool bHasArchetypeMesh = MetaData && !MetaData->Mesh.IsNull();
 
-    // Find all ArrowComponents on this actor
-    TArray<UArrowComponent*> Arrows;
-    GetComponents<UArrowComponent>(Arrows);
+    // Levels saved before the preview existed hold the archetype mesh on Visual itself; drop that hard reference
+    if (Bunker && bHasArchetypeMesh && Bunker->GetStaticMesh() && FSoftObjectPath(Bunker->GetStaticMesh()) == MetaData->Mesh.ToSoftObjectPath())
+    {
+        Bunker->SetStaticMesh(nullptr);
+    }
 
-    if (Arrows.Num() == 0)
+    if (!Bunker || Bunker->GetStaticMesh() || !bHasArchetypeMesh)
     {
-        UE_LOG(LogTemp, Warning, TEXT("[Bunker] No ArrowComponents found, cannot create slots."));
+        if (IsValid(ArchetypePreview)) ArchetypePreview->DestroyComponent();
+        ArchetypePreview = nullptr;
         return;
     }
 
-    for (UArrowComponent* Arrow : Arrows)
+    // Construction-script components are destroyed on every rerun, so this is usually a fresh one
+    if (!IsValid(ArchetypePreview))
     {
-        if (!Arrow || Arrow == RootComponent) continue;
-
-        FCoverSlot NewSlot;
-        NewSlot.SlotName = Arrow->GetFName();
-
-        // Properly set FComponentReference to point to this Arrow
-        NewSlot.SlotPoint.OtherActor = this;
-        NewSlot.SlotPoint.ComponentProperty = Arrow->GetFName();
-        NewSlot.bUseComponentTransform = true;
-
-        NewSlot.LocalAnchor = FTransform::Identity;
-        Slots.Add(NewSlot);
-
-        UE_LOG(LogTemp, Warning, TEXT("[Bunker] Added slot from arrow: %s"), *Arrow->GetName());
+        ArchetypePreview = NewObject<UStaticMeshComponent>(this, MakeUniqueObjectName(this, UStaticMeshComponent::StaticClass(), TEXT("ArchetypePreview")), RF_Transient);
+        ArchetypePreview->CreationMethod = EComponentCreationMethod::UserConstructionScript;
+        ArchetypePreview->bIsEditorOnly = true;
+        ArchetypePreview->SetHiddenInGame(true);
+        ArchetypePreview->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+        ArchetypePreview->SetCanEverAffectNavigation(false);
+        ArchetypePreview->SetupAttachment(Bunker);
+        ArchetypePreview->RegisterComponent();
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("[Bunker] Rebuild complete: %d slots created."), Slots.Num());
+    // Re-read every construction so edits to the archetype show up on placed bunkers
+    ArchetypePreview->SetStaticMesh(MetaData->Mesh.LoadSynchronous());
 }
 #endif
-
-#if WITH_EDITOR
-EDataValidationResult ABunkerBase::IsDataValid(FDataValidationContext& Context) const
-{
-    // Don’t hard-fail. A bunker can exist without slots; just warn designers.
-    if (Slots.Num() == 0)
-    {
-        Context.AddWarning(FText::FromString(TEXT(
-            "Bunker has no slots. Add Arrow Components or then click 'Rebuild Slots From Children'." )));
-    }
-    return EDataValidationResult::Valid;
-}
-#endif
\ No newline at end of file
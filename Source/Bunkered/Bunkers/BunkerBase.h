@@ -5,13 +5,15 @@
 #include "Types/CoverTypes.h"
 #include "BunkerBase.generated.h"
 
+class UBunkerMetaData;
+
 UCLASS(Blueprintable)
 class BUNKERED_API ABunkerBase : public AActor
 {
     GENERATED_BODY()
 
 public:
-    ABunkerBase();
+    ABunkerBase(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
     UFUNCTION(BlueprintCallable, Category="Cover")
     int32 FindClosestValidSlot(const FVector& WorldLocation, float MaxDist, int32& OutExactIndex) const;
@@ -20,29 +22,54 @@ public:
     FTransform GetSlotWorldTransform(int32 SlotIndex) const;
 
     UFUNCTION(BlueprintCallable, Category="Cover")
-    const FCoverSlot& GetSlot(int32 SlotIndex) const { return Slots[SlotIndex]; }
+    const FCoverSlot& GetSlot(int32 SlotIndex) const { return GetSlots()[SlotIndex]; }
 
     UFUNCTION(BlueprintCallable, Category="Cover")
-    int32 GetNumSlots() const { return Slots.Num(); }
+    int32 GetNumSlots() const { return GetSlots().Num(); }
 
-#if WITH_EDITOR
-    /** Scans child components with SlotTag and rebuilds Slots to reference them. */
-    UFUNCTION(CallInEditor, Category="Cover|Authoring")
-    void RebuildSlotsFromChildren();
+    /** This bunker's own Slots, or its archetype's SlotTemplate when it has none */
+    const TArray<FCoverSlot>& GetSlots() const;
+
+    /** Slot reached by traversing Delta slots from SlotIndex (clamped to the same piece of cover) */
+    virtual int32 GetAdjacentSlot(int32 SlotIndex, int32 Delta) const;
+
+    /** True if both slots belong to the same piece of cover (always, for a plain bunker) */
+    virtual bool IsSameCover(int32 SlotA, int32 SlotB) const { return true; }
+
+    /** True if Hit is on the cover that shelters SlotIndex, i.e. the slot itself is what's being seen */
+    virtual bool IsSlotOwnCover(int32 SlotIndex, const FHitResult& Hit) const;
 
-    /** Adds SlotTag to all Arrow children (non-destructive; only adds if missing). */
-    UFUNCTION(CallInEditor, Category="Cover|Authoring")
-    void TagAllArrowChildrenAsSlots();
+    /** Heap bytes held by this bunker's own slot array (archetype slots are shared, not counted) */
+    SIZE_T GetSlotsAllocatedSize() const { return Slots.GetAllocatedSize(); }
+
+    UFUNCTION(BlueprintPure, Category="Bunker")
+    UBunkerMetaData* GetMetaData() const { return MetaData; }
+
+    /** Replaces the slots with plain local anchors (procedural fields, benchmarks). Re-publishes them to the slot store. */
+    void SetSlotAnchors(TConstArrayView<FTransform> LocalAnchors);
+
+#if WITH_EDITOR
+    /** Fired from OnConstruction so editor tooling (BunkeredEditor) can sync authoring data */
+    DECLARE_MULTICAST_DELEGATE_OneParam(FOnBunkerConstructed, ABunkerBase*);
+    static FOnBunkerConstructed OnBunkerConstructed;
 #endif
 
 protected:
+    virtual void PostInitializeComponents() override;
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
     USceneComponent* Root;
 
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
     UStaticMeshComponent* Bunker;
 
-    /** Designer-authored cover slots (may reference child components). */
+    /** Bunker type (archetype): surface properties for paintball hits, the mesh (replaces Visual's at runtime when set), and the shared slots when this instance has none. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Bunker")
+    TObjectPtr<UBunkerMetaData> MetaData;
+
+    /** Designer-authored cover slots (may reference child components). Leave empty to use the archetype's SlotTemplate. */
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Cover")
     TArray<FCoverSlot> Slots;
     
@@ -62,10 +89,24 @@ protected:
     UPROPERTY(EditAnywhere, Category="Cover|Authoring")
     bool bAutoTagArrowChildren = true;
 
+    /** Sets Target's mesh from Type's soft mesh: now if loaded, on completion of the level's preload (UBunkerArchetypeSubsystem), else loads it. */
+    void ApplyArchetypeMesh(const UBunkerMetaData* Type, UStaticMeshComponent* Target);
+
 #if WITH_EDITOR
     virtual void OnConstruction(const FTransform& Transform) override;
+#endif
 
-    /** Editor data validation hook (Window → Developer Tools → Data Validation). */
-    virtual EDataValidationResult IsDataValid(class FDataValidationContext& Context) const override;
+private:
+#if WITH_EDITORONLY_DATA
+    /** Editor view of the archetype mesh. Transient, so placed bunkers never save a hard reference to it. */
+    UPROPERTY(Transient)
+    TObjectPtr<UStaticMeshComponent> ArchetypePreview;
 #endif
+
+#if WITH_EDITOR
+    void UpdateArchetypePreview();
+#endif
+
+    /** Slot authoring (rebuild from arrows, tagging) lives in the editor module */
+    friend class FBunkerAuthoring;
 };
@@ -0,0 +1,148 @@
+// Bunkers/BunkerFieldGenerator.cpp
+#include "Bunkers/BunkerFieldGenerator.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "DataAsset/BunkerFieldLayout.h"
+#include "DataAsset/BunkerMetaData.h"
+#include "Subsystems/PaintballSubsystem.h"
+#include "Utility/BunkerProfiling.h"
+
+ABunkerFieldGenerator::ABunkerFieldGenerator(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer.DoNotCreateDefaultSubobject(TEXT("Visual")))
+{
+    // Slots come from the layout, not from arrow children
+    bAutoSyncSlotsFromChildren = false;
+}
+
+void ABunkerFieldGenerator::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
+
+    // Before BeginPlay, which publishes the slots; archetype meshes are already preloaded with the map
+    if (GetWorld() && GetWorld()->IsGameWorld())
+    {
+        Generate();
+    }
+}
+
+void ABunkerFieldGenerator::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (UPaintballSubsystem* Paintballs = GetWorld()->GetSubsystem<UPaintballSubsystem>())
+    {
+        for (int32 i = 0; i < TypeMeshes.Num(); ++i)
+        {
+            Paintballs->RegisterSurfaceComponent(TypeMeshes[i], Paintballs->RegisterSurface(TypeAssets[i]));
+        }
+    }
+}
+
+void ABunkerFieldGenerator::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UPaintballSubsystem* Paintballs = GetWorld()->GetSubsystem<UPaintballSubsystem>())
+    {
+        for (const UHierarchicalInstancedStaticMeshComponent* Mesh : TypeMeshes)
+        {
+            Paintballs->UnregisterSurfaceComponent(Mesh);
+        }
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+#if WITH_EDITOR
+void ABunkerFieldGenerator::OnConstruction(const FTransform& Transform)
+{
+    Super::OnConstruction(Transform);
+
+    // Editor preview; the generated components are transient and rebuilt again when the game world loads
+    Generate();
+}
+#endif
+
+void ABunkerFieldGenerator::ClearGenerated()
+{
+    for (UHierarchicalInstancedStaticMeshComponent* Mesh : TypeMeshes)
+    {
+        if (IsValid(Mesh))
+        {
+            Mesh->DestroyComponent();
+        }
+    }
+    TypeMeshes.Reset();
+    TypeAssets.Reset();
+    FieldBunkers.Reset();
+    FieldBunkerBySlot.Reset();
+    Slots.Reset();
+}
+
+int32 ABunkerFieldGenerator::FindOrAddType(const UBunkerMetaData* Type)
+{
+    const int32 Existing = TypeAssets.Find(Type);
+    if (Existing != INDEX_NONE) return Existing;
+
+    UHierarchicalInstancedStaticMeshComponent* Mesh = NewObject<UHierarchicalInstancedStaticMeshComponent>(
+        this, MakeUniqueObjectName(this, UHierarchicalInstancedStaticMeshComponent::StaticClass(), Type->GetFName()), RF_Transient);
+    Mesh->CreationMethod = EComponentCreationMethod::UserConstructionScript;
+    Mesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+    Mesh->SetCanEverAffectNavigation(false);
+    Mesh->SetupAttachment(RootComponent);
+    Mesh->RegisterComponent();
+    ApplyArchetypeMesh(Type, Mesh);
+
+    TypeMeshes.Add(Mesh);
+    return TypeAssets.Add(Type);
+}
+
+void ABunkerFieldGenerator::Generate()
+{
+    LLM_SCOPE_BYTAG(Bunker_Slots);
+
+    ClearGenerated();
+    if (!Layout) return;
+
+    TArray<FBunkerFieldPlacement> Placements;
+    Layout->GetPlacements(Placements);
+    FieldBunkers.Reserve(Placements.Num());
+
+    for (const FBunkerFieldPlacement& Placement : Placements)
+    {
+        FFieldBunker& Field = FieldBunkers.AddDefaulted_GetRef();
+        Field.TypeIndex = FindOrAddType(Placement.Type);
+        Field.InstanceIndex = TypeMeshes[Field.TypeIndex]->AddInstance(Placement.Transform, /*bWorldSpace=*/false);
+        Field.FirstSlot = Slots.Num();
+        Field.NumSlots = Placement.Type->SlotTemplate.Num();
+
+        for (const FCoverSlot& Template : Placement.Type->SlotTemplate)
+        {
+            // Template anchors are bunker-relative; ours are relative to the field
+            FCoverSlot& Slot = Slots.Add_GetRef(Template);
+            Slot.bUseComponentTransform = false;
+            Slot.LocalAnchor = Template.LocalAnchor * Placement.Transform;
+            FieldBunkerBySlot.Add(FieldBunkers.Num() - 1);
+        }
+    }
+}
+
+int32 ABunkerFieldGenerator::GetAdjacentSlot(int32 SlotIndex, int32 Delta) const
+{
+    if (!FieldBunkerBySlot.IsValidIndex(SlotIndex)) return Super::GetAdjacentSlot(SlotIndex, Delta);
+
+    const FFieldBunker& Field = FieldBunkers[FieldBunkerBySlot[SlotIndex]];
+    return FMath::Clamp(SlotIndex + Delta, Field.FirstSlot, Field.FirstSlot + Field.NumSlots - 1);
+}
+
+bool ABunkerFieldGenerator::IsSameCover(int32 SlotA, int32 SlotB) const
+{
+    return FieldBunkerBySlot.IsValidIndex(SlotA) && FieldBunkerBySlot.IsValidIndex(SlotB)
+        && FieldBunkerBySlot[SlotA] == FieldBunkerBySlot[SlotB];
+}
+
+bool ABunkerFieldGenerator::IsSlotOwnCover(int32 SlotIndex, const FHitResult& Hit) const
+{
+    if (!FieldBunkerBySlot.IsValidIndex(SlotIndex)) return false;
+
+    // Every bunker on the field is this actor; only the slot's own instance counts
+    const FFieldBunker& Field = FieldBunkers[FieldBunkerBySlot[SlotIndex]];
+    return Hit.GetComponent() == TypeMeshes[Field.TypeIndex] && Hit.Item == Field.InstanceIndex;
+}
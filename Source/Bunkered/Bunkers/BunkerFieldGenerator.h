@@ -0,0 +1,73 @@
+// Bunkers/BunkerFieldGenerator.h
+#pragma once
+#include "CoreMinimal.h"
+#include "Bunkers/BunkerBase.h"
+#include "BunkerFieldGenerator.generated.h"
+
+class UBunkerFieldLayout;
+class UBunkerMetaData;
+class UHierarchicalInstancedStaticMeshComponent;
+
+/**
+ * Builds a whole paintball field from a UBunkerFieldLayout: one HISM per bunker type for visuals and collision,
+ * and every bunker's template slots flattened into this actor's slot list, so the field publishes to the slot
+ * store as a single bunker. Traversal and exposure stay per placed bunker via the ABunkerBase slot overrides.
+ */
+UCLASS()
+class BUNKERED_API ABunkerFieldGenerator : public ABunkerBase
+{
+    GENERATED_BODY()
+
+public:
+    ABunkerFieldGenerator(const FObjectInitializer& ObjectInitializer);
+
+    virtual int32 GetAdjacentSlot(int32 SlotIndex, int32 Delta) const override;
+    virtual bool IsSameCover(int32 SlotA, int32 SlotB) const override;
+    virtual bool IsSlotOwnCover(int32 SlotIndex, const FHitResult& Hit) const override;
+
+    /** Rebuilds meshes and slots from Layout */
+    UFUNCTION(CallInEditor, BlueprintCallable, Category="Field")
+    void Generate();
+
+    UBunkerFieldLayout* GetLayout() const { return Layout; }
+
+    /** Number of bunkers placed by the last Generate() */
+    int32 GetNumFieldBunkers() const { return FieldBunkers.Num(); }
+
+protected:
+    virtual void PostInitializeComponents() override;
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+#if WITH_EDITOR
+    virtual void OnConstruction(const FTransform& Transform) override;
+#endif
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Field")
+    TObjectPtr<UBunkerFieldLayout> Layout;
+
+private:
+    /** One placed bunker: its HISM instance and its range in Slots */
+    struct FFieldBunker
+    {
+        int32 TypeIndex = INDEX_NONE;
+        int32 InstanceIndex = INDEX_NONE;
+        int32 FirstSlot = 0;
+        int32 NumSlots = 0;
+    };
+
+    /** Generated per type, parallel to TypeAssets. Transient: rebuilt on construction and on BeginPlay. */
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UHierarchicalInstancedStaticMeshComponent>> TypeMeshes;
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<const UBunkerMetaData>> TypeAssets;
+
+    TArray<FFieldBunker> FieldBunkers;
+
+    /** FieldBunkers index per slot */
+    TArray<int32> FieldBunkerBySlot;
+
+    void ClearGenerated();
+    int32 FindOrAddType(const UBunkerMetaData* Type);
+};
@@ -0,0 +1,83 @@
+// Camera/BunkerCoverCameraModifier.cpp
+#include "Camera/BunkerCoverCameraModifier.h"
+#include "Bunkers/BunkerBase.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/BunkerCoverComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/SpringArmComponent.h"
+
+bool UBunkerCoverCameraModifier::ModifyCamera(float DeltaTime, FMinimalViewInfo& InOutPOV)
+{
+    Super::ModifyCamera(DeltaTime, InOutPOV);
+
+    AActor* ViewTarget = CameraOwner ? CameraOwner->GetViewTarget() : nullptr;
+    if (ViewTarget != BoundTarget.Get())
+    {
+        BindToViewTarget(ViewTarget);
+    }
+
+    CurrentOffset = FMath::VInterpTo(CurrentOffset, TargetOffset, DeltaTime, InterpSpeed);
+    CurrentRoll = FMath::FInterpTo(CurrentRoll, TargetRoll, DeltaTime, InterpSpeed);
+    if (CurrentOffset.IsNearlyZero(0.1f) && FMath::IsNearlyZero(CurrentRoll, 0.01f)) return false;
+
+    FVector Desired = InOutPOV.Location + InOutPOV.Rotation.RotateVector(CurrentOffset);
+
+    // Same probe the spring arm uses, so a peek next to a wall doesn't put the camera inside it
+    const USpringArmComponent* Arm = Boom.Get();
+    if (Arm && Arm->bDoCollisionTest && !CurrentOffset.IsNearlyZero(0.1f))
+    {
+        FCollisionQueryParams Params(SCENE_QUERY_STAT(BunkerCoverCamera), false, ViewTarget);
+        FHitResult Hit;
+        if (GetWorld()->SweepSingleByChannel(Hit, InOutPOV.Location, Desired, FQuat::Identity, Arm->ProbeChannel,
+            FCollisionShape::MakeSphere(Arm->ProbeSize), Params))
+        {
+            Desired = Hit.Location;
+        }
+    }
+
+    InOutPOV.Location = Desired;
+    InOutPOV.Rotation.Roll += CurrentRoll;
+    return false;
+}
+
+void UBunkerCoverCameraModifier::BindToViewTarget(AActor* ViewTarget)
+{
+    if (UBunkerCoverComponent* Old = Cover.Get())
+    {
+        Old->OnPeekChanged.RemoveDynamic(this, &UBunkerCoverCameraModifier::HandlePeekChanged);
+    }
+
+    BoundTarget = ViewTarget;
+    Cover = ViewTarget ? ViewTarget->FindComponentByClass<UBunkerCoverComponent>() : nullptr;
+    Boom = ViewTarget ? ViewTarget->FindComponentByClass<USpringArmComponent>() : nullptr;
+
+    if (UBunkerCoverComponent* New = Cover.Get())
+    {
+        New->OnPeekChanged.AddUniqueDynamic(this, &UBunkerCoverCameraModifier::HandlePeekChanged);
+        HandlePeekChanged(New->GetPeek(), New->GetPeek() != EPeekDirection::None);
+    }
+    else
+    {
+        TargetOffset = FVector::ZeroVector;
+        TargetRoll = 0.f;
+    }
+}
+
+void UBunkerCoverCameraModifier::HandlePeekChanged(EPeekDirection NewPeek, bool bIsPeeking)
+{
+    TargetOffset = FVector::ZeroVector;
+    TargetRoll = 0.f;
+
+    const UBunkerCoverComponent* CoverComp = Cover.Get();
+    const ABunkerBase* Bunker = CoverComp ? CoverComp->GetCurrentBunker() : nullptr;
+    if (!bIsPeeking || !Bunker || CoverComp->GetCurrentSlot() == INDEX_NONE) return;
+
+    const FCoverSlot& Slot = Bunker->GetSlot(CoverComp->GetCurrentSlot());
+    switch (NewPeek)
+    {
+    case EPeekDirection::Left:  TargetOffset.Y = -Slot.LateralPeekOffset; TargetRoll = -LeanRoll; break;
+    case EPeekDirection::Right: TargetOffset.Y = +Slot.LateralPeekOffset; TargetRoll = +LeanRoll; break;
+    case EPeekDirection::Over:  TargetOffset.Z = +Slot.VerticalPeekOffset; break;
+    default: break;
+    }
+}
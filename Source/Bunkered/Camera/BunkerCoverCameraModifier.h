@@ -0,0 +1,48 @@
+// Camera/BunkerCoverCameraModifier.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Camera/CameraModifier.h"
+#include "Types/CoverTypes.h"
+#include "BunkerCoverCameraModifier.generated.h"
+
+class UBunkerCoverComponent;
+class USpringArmComponent;
+
+/**
+ * Peek camera for cover. Follows the view target's UBunkerCoverComponent::OnPeekChanged and eases the view toward
+ * the slot's peek offset and a lean roll, so peeking is smooth on the owning client and costs nothing on the pawn.
+ * The view target's spring arm is cached on bind; its probe settings keep the offset camera out of walls.
+ */
+UCLASS()
+class BUNKERED_API UBunkerCoverCameraModifier : public UCameraModifier
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool ModifyCamera(float DeltaTime, FMinimalViewInfo& InOutPOV) override;
+
+    /** Roll applied while peeking left/right (degrees) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Cover Camera")
+    float LeanRoll = 10.f;
+
+    /** How fast offset and roll ease toward their targets */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Cover Camera", meta=(ClampMin="0.0"))
+    float InterpSpeed = 10.f;
+
+private:
+    TWeakObjectPtr<AActor> BoundTarget;
+    TWeakObjectPtr<UBunkerCoverComponent> Cover;
+    TWeakObjectPtr<USpringArmComponent> Boom;
+
+    /** View-space offset (X unused, Y right, Z up) and roll, current and target */
+    FVector CurrentOffset = FVector::ZeroVector;
+    FVector TargetOffset = FVector::ZeroVector;
+    float CurrentRoll = 0.f;
+    float TargetRoll = 0.f;
+
+    void BindToViewTarget(AActor* ViewTarget);
+
+    UFUNCTION()
+    void HandlePeekChanged(EPeekDirection NewPeek, bool bIsPeeking);
+};
@@ -10,6 +10,7 @@
 #include "GameFramework/SpringArmComponent.h"
 #include "GameFramework/Controller.h"
 #include "Components/BunkerCoverComponent.h"
+#include "Components/MarkerFireComponent.h"
 #include "Bunkers/BunkerBase.h"
 #include "Kismet/GameplayStatics.h"
 #include "Utility/LoggingMacros.h"
@@ -52,6 +53,9 @@ ABunkeredCharacter::ABunkeredCharacter()
     // Cover component
     BunkerCoverComponent = CreateDefaultSubobject<UBunkerCoverComponent>(TEXT("BunkerCoverComponent"));
 
+    // Marker
+    MarkerFireComponent = CreateDefaultSubobject<UMarkerFireComponent>(TEXT("MarkerFireComponent"));
+
     // Create & wire the BunkerAdvisorComponent if not already created elsewhere
     if (!FindComponentByClass<UBunkerAdvisorComponent>())
     {
@@ -83,7 +87,7 @@ void ABunkeredCharacter::SetupPlayerInputComponent(UInputComponent* InputComp)
 
 void ABunkeredCharacter::HandleBeginTraverseTo(ABunkerBase* TargetBunker, int32 TargetSlot)
 {
-    DEBUG(5.0f, FColor::Green, TEXT("ABunkeredCharacter::HandleBeginTraverseTo() ---- Traversing dawg"));
+    BUNKER_LOG(LogBunkerNav, Verbose, TEXT("%s traversing to %s slot %d"), *GetName(), *GetNameSafe(TargetBunker), TargetSlot);
     
     if (!TargetBunker) return;
     PendingBunker = TargetBunker;
@@ -227,7 +231,7 @@ void ABunkeredCharacter::EnterSlotOnBunker_Implementation()
 
     if (BunkerCoverComponent->IsInCover())
     {
-        DEBUG(5.0f, FColor::Red, TEXT("Ignoring EnterSlotOnBunker"));
+        BUNKER_LOG(LogBunkerInput, Verbose, TEXT("%s EnterSlotOnBunker while in cover, exiting"), *GetName());
         BunkerCoverComponent->ExitCover();
     }
     else
@@ -269,7 +273,6 @@ void ABunkeredCharacter::SlotPeek_Implementation(EPeekDirection Direction, bool
 {
     if (BunkerCoverComponent)
     {
-        DEBUG(5.0f, FColor::Green, TEXT("---- ABunkeredCharacter::SlotPeek_Implementation() ---"));
         BunkerCoverComponent->SetPeek(Direction, bPressed);
     }
 }
@@ -287,11 +290,18 @@ void ABunkeredCharacter::Pawn_MouseLook_Implementation(FVector2D Look)
 
 void ABunkeredCharacter::Pawn_ChangeBunkerStance_Implementation(bool bCrouching)
 {
-    
-    DEBUG(5.0f, FColor::Green, TEXT("IsCrouching: [%i]"), bCrouching);
+    BUNKER_LOG(LogBunkerInput, Verbose, TEXT("%s ChangeBunkerStance crouching=%d"), *GetName(), bCrouching);
     DoCrouchToggle();
 }
 
+void ABunkeredCharacter::Pawn_Trigger_Implementation(bool bPressed)
+{
+    if (!MarkerFireComponent) return;
+
+    if (bPressed) MarkerFireComponent->PullTrigger();
+    else          MarkerFireComponent->ReleaseTrigger();
+}
+
 // ===== Optional helpers =====
 void ABunkeredCharacter::DoMove(float Right, float Forward)
 {
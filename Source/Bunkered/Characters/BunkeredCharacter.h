@@ -11,6 +11,7 @@
 class UBunkerAdvisorComponent;
 class ABunkerBase;
 class UBunkerCoverComponent;
+class UMarkerFireComponent;
 class USpringArmComponent;
 class UCameraComponent;
 
@@ -36,6 +37,9 @@ class BUNKERED_API ABunkeredCharacter : public ACharacter, public IBunkerCoverIn
 public:
     ABunkeredCharacter();
 
+    /** Closest bunker slot within entry reach of the pawn. Used by EnterSlotOnBunker; public for the advisor benchmark. */
+    bool FindNearbyBunkerAndSlot(ABunkerBase*& OutBunker, int32& OutSlot) const;
+
     /** Bunker Cover Component */
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Components")
     TObjectPtr<UBunkerCoverComponent> BunkerCoverComponent;
@@ -43,6 +47,10 @@ public:
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Components")
     TObjectPtr<UBunkerAdvisorComponent> BunkerAdvisorComponent;
 
+    /** Marker fire scheduling (sub-frame shot timing, batched server fire) */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Components")
+    TObjectPtr<UMarkerFireComponent> MarkerFireComponent;
+
 protected:
     // === IBunkerCoverInterface ===
     virtual void EnterSlotOnBunker_Implementation() override;
@@ -52,9 +60,7 @@ protected:
     virtual void Pawn_Movement_Implementation(FVector2D Move) override;
     virtual void Pawn_MouseLook_Implementation(FVector2D Look) override;
     virtual void Pawn_ChangeBunkerStance_Implementation(bool bCrouching) override;
-
-    // Helper: find nearby bunker/slot (you can swap to EQS later)
-    bool FindNearbyBunkerAndSlot(ABunkerBase*& OutBunker, int32& OutSlot) const;
+    virtual void Pawn_Trigger_Implementation(bool bPressed) override;
 
     // No input binding here; PC handles inputs.
     virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
@@ -0,0 +1,319 @@
+// Commandlets/BunkerAdvisorBenchmarkCommandlet.cpp
+#include "Commandlets/BunkerAdvisorBenchmarkCommandlet.h"
+#include "Bunkers/BunkerBase.h"
+#include "Characters/BunkeredCharacter.h"
+#include "Components/BunkerAdvisorComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/TargetPoint.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogBunkerBench, Log, All);
+
+namespace BunkerBench
+{
+    constexpr int32 SlotsPerBunker = 2;
+    constexpr int32 DefaultIterations = 200;
+    constexpr float DefaultThreshold = 0.15f;
+    constexpr int32 Seed = 1337;
+
+    /** Bunkers sit on a grid this far apart, so bigger fields also cover more ground */
+    constexpr float GridSpacing = 400.f;
+
+    /** Enemies stand on a ring around the querying pawn */
+    constexpr float EnemyRingRadius = 2500.f;
+
+    const TCHAR* CubePath = TEXT("/Engine/BasicShapes/Cube.Cube");
+
+    struct FResult
+    {
+        FString Name;
+        int32 NumSlots = 0;
+        int32 NumEnemies = 0;
+        double P50 = 0.0, P90 = 0.0, P99 = 0.0, Max = 0.0;
+    };
+
+    TArray<int32> ParseList(const FString& Params, const TCHAR* Key, TArray<int32> Default)
+    {
+        FString Value;
+        if (!FParse::Value(*Params, Key, Value, /*bShouldStopOnSeparator=*/false)) return Default;
+
+        TArray<FString> Parts;
+        Value.ParseIntoArray(Parts, TEXT(","));
+
+        TArray<int32> Out;
+        for (const FString& Part : Parts)
+        {
+            const int32 N = FCString::Atoi(*Part);
+            if (N >= 0) Out.Add(N);
+        }
+        return Out.Num() ? Out : Default;
+    }
+
+    FString CaseKey(const TCHAR* Name, int32 NumSlots, int32 NumEnemies)
+    {
+        return FString::Printf(TEXT("%s/%d/%d"), Name, NumSlots, NumEnemies);
+    }
+
+    /** Sorts Samples (ms) in place and fills the percentiles */
+    void Summarize(TArray<double>& Samples, FResult& Out)
+    {
+        if (Samples.Num() == 0) return;
+        Samples.Sort();
+
+        auto Percentile = [&Samples](double P)
+        {
+            const int32 Index = FMath::Clamp(FMath::CeilToInt(P * Samples.Num()) - 1, 0, Samples.Num() - 1);
+            return Samples[Index];
+        };
+        Out.P50 = Percentile(0.50);
+        Out.P90 = Percentile(0.90);
+        Out.P99 = Percentile(0.99);
+        Out.Max = Samples.Last();
+    }
+
+    UWorld* CreateBenchWorld()
+    {
+        UWorld* World = UWorld::CreateWorld(EWorldType::Game, /*bInformEngineOfWorld=*/false, TEXT("BunkerBenchWorld"));
+        FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+        Context.SetCurrentWorld(World);
+
+        World->InitializeActorsForPlay(FURL());
+
+        // No game mode in a transient world; begin play directly so spawned actors run BeginPlay
+        World->GetWorldSettings()->NotifyBeginPlay();
+        return World;
+    }
+
+    void DestroyBenchWorld(UWorld* World)
+    {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+    }
+
+    /** Square grid of bunkers centred on the origin, SlotsPerBunker slots each (front and back face) */
+    void SpawnField(UWorld& World, int32 NumSlots, UStaticMesh* Mesh)
+    {
+        const int32 NumBunkers = FMath::DivideAndRoundUp(NumSlots, SlotsPerBunker);
+        const int32 Side = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumBunkers)));
+        const float HalfExtent = 0.5f * (Side - 1) * GridSpacing;
+
+        FRandomStream Rand(Seed);
+        int32 Remaining = NumSlots;
+        for (int32 b = 0; b < NumBunkers; ++b)
+        {
+            // Offset half a cell so the pawn at the origin never spawns inside a bunker
+            const FVector Location((b % Side) * GridSpacing - HalfExtent + 0.5f * GridSpacing, (b / Side) * GridSpacing - HalfExtent, 0.f);
+            const FRotator Rotation(0.f, Rand.FRandRange(0.f, 360.f), 0.f);
+
+            ABunkerBase* Bunker = World.SpawnActor<ABunkerBase>(Location, Rotation);
+            if (!Bunker) continue;
+
+            if (UStaticMeshComponent* Visual = Bunker->FindComponentByClass<UStaticMeshComponent>())
+            {
+                Visual->SetStaticMesh(Mesh);
+                Visual->SetRelativeLocation(FVector(0.f, 0.f, 50.f));
+            }
+
+            TArray<FTransform, TInlineAllocator<SlotsPerBunker>> Anchors;
+            for (int32 s = 0; s < SlotsPerBunker && Remaining > 0; ++s, --Remaining)
+            {
+                const float Facing = s == 0 ? 1.f : -1.f;
+                Anchors.Add(FTransform(FRotator(0.f, s == 0 ? 0.f : 180.f, 0.f), FVector(-Facing * 90.f, 0.f, 0.f)));
+            }
+            Bunker->SetSlotAnchors(Anchors);
+        }
+    }
+}
+
+UBunkerAdvisorBenchmarkCommandlet::UBunkerAdvisorBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+}
+
+int32 UBunkerAdvisorBenchmarkCommandlet::Main(const FString& Params)
+{
+    using namespace BunkerBench;
+
+    const TArray<int32> SlotCounts = ParseList(Params, TEXT("Slots="), { 10, 100, 1000, 10000 });
+    const TArray<int32> EnemyCounts = ParseList(Params, TEXT("Enemies="), { 0, 5, 10, 20 });
+
+    int32 Iterations = DefaultIterations;
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+    Iterations = FMath::Max(Iterations, 1);
+
+    UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, CubePath);
+    if (!Cube)
+    {
+        UE_LOG(LogBunkerBench, Warning, TEXT("%s not found; bunkers will have no collision and every slot reads as exposed"), CubePath);
+    }
+
+    int32 MaxEnemies = 0;
+    for (const int32 N : EnemyCounts) MaxEnemies = FMath::Max(MaxEnemies, N);
+
+    TArray<FResult> Results;
+    for (const int32 NumSlots : SlotCounts)
+    {
+        UWorld* World = CreateBenchWorld();
+        SpawnField(*World, NumSlots, Cube);
+
+        ABunkeredCharacter* Pawn = World->SpawnActor<ABunkeredCharacter>(FVector(0.f, 0.f, 100.f), FRotator::ZeroRotator);
+        UBunkerAdvisorComponent* Advisor = Pawn ? Pawn->FindComponentByClass<UBunkerAdvisorComponent>() : nullptr;
+        if (!Advisor)
+        {
+            UE_LOG(LogBunkerBench, Error, TEXT("Could not spawn a pawn with an advisor"));
+            DestroyBenchWorld(World);
+            return 1;
+        }
+        Advisor->bShowSuggestionIndicator = false;
+
+        TArray<AActor*> Enemies;
+        for (int32 e = 0; e < MaxEnemies; ++e)
+        {
+            const float Angle = 2.f * PI * e / MaxEnemies;
+            const FVector Location(EnemyRingRadius * FMath::Cos(Angle), EnemyRingRadius * FMath::Sin(Angle), 100.f);
+            Enemies.Add(World->SpawnActor<ATargetPoint>(Location, FRotator::ZeroRotator));
+        }
+
+        // Nearby lookup doesn't depend on enemies; time it once per field
+        {
+            FResult& Result = Results.AddDefaulted_GetRef();
+            Result.Name = TEXT("FindNearbyBunkerAndSlot");
+            Result.NumSlots = NumSlots;
+
+            TArray<double> Samples;
+            Samples.Reserve(Iterations);
+            for (int32 i = 0; i < Iterations; ++i)
+            {
+                ABunkerBase* Bunker = nullptr; int32 Slot = INDEX_NONE;
+                const uint64 Start = FPlatformTime::Cycles64();
+                Pawn->FindNearbyBunkerAndSlot(Bunker, Slot);
+                Samples.Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - Start));
+            }
+            Summarize(Samples, Result);
+        }
+
+        for (const int32 NumEnemies : EnemyCounts)
+        {
+            Advisor->SetKnownEnemies(MakeArrayView(Enemies.GetData(), FMath::Min(NumEnemies, Enemies.Num())));
+
+            FResult& Result = Results.AddDefaulted_GetRef();
+            Result.Name = TEXT("UpdateSuggestion");
+            Result.NumSlots = NumSlots;
+            Result.NumEnemies = NumEnemies;
+
+            TArray<double> Samples;
+            Samples.Reserve(Iterations);
+            for (int32 i = 0; i < Iterations; ++i)
+            {
+                const uint64 Start = FPlatformTime::Cycles64();
+                Advisor->UpdateSuggestion();
+                Samples.Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - Start));
+            }
+            Summarize(Samples, Result);
+        }
+
+        DestroyBenchWorld(World);
+    }
+
+    // Report
+    TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+    Report->SetStringField(TEXT("Timestamp"), FDateTime::UtcNow().ToIso8601());
+    Report->SetNumberField(TEXT("Iterations"), Iterations);
+
+    TArray<TSharedPtr<FJsonValue>> Cases;
+    for (const FResult& R : Results)
+    {
+        TSharedRef<FJsonObject> Case = MakeShared<FJsonObject>();
+        Case->SetStringField(TEXT("Name"), R.Name);
+        Case->SetNumberField(TEXT("Slots"), R.NumSlots);
+        Case->SetNumberField(TEXT("Enemies"), R.NumEnemies);
+        Case->SetNumberField(TEXT("P50Ms"), R.P50);
+        Case->SetNumberField(TEXT("P90Ms"), R.P90);
+        Case->SetNumberField(TEXT("P99Ms"), R.P99);
+        Case->SetNumberField(TEXT("MaxMs"), R.Max);
+        Cases.Add(MakeShared<FJsonValueObject>(Case));
+
+        UE_LOG(LogBunkerBench, Display, TEXT("%-24s slots=%-6d enemies=%-3d p50=%.4fms p90=%.4fms p99=%.4fms max=%.4fms"),
+            *R.Name, R.NumSlots, R.NumEnemies, R.P50, R.P90, R.P99, R.Max);
+    }
+    Report->SetArrayField(TEXT("Cases"), Cases);
+
+    // Regression check against a previous report
+    int32 ExitCode = 0;
+    FString BaselinePath;
+    if (FParse::Value(*Params, TEXT("Baseline="), BaselinePath))
+    {
+        float Threshold = DefaultThreshold;
+        FParse::Value(*Params, TEXT("Threshold="), Threshold);
+
+        FString BaselineText;
+        TSharedPtr<FJsonObject> Baseline;
+        if (!FFileHelper::LoadFileToString(BaselineText, *BaselinePath)
+            || !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BaselineText), Baseline) || !Baseline.IsValid())
+        {
+            UE_LOG(LogBunkerBench, Error, TEXT("Could not read baseline %s"), *BaselinePath);
+            return 1;
+        }
+
+        TMap<FString, TSharedPtr<FJsonObject>> BaselineCases;
+        for (const TSharedPtr<FJsonValue>& Value : Baseline->GetArrayField(TEXT("Cases")))
+        {
+            const TSharedPtr<FJsonObject> Case = Value->AsObject();
+            BaselineCases.Add(CaseKey(*Case->GetStringField(TEXT("Name")), Case->GetIntegerField(TEXT("Slots")), Case->GetIntegerField(TEXT("Enemies"))), Case);
+        }
+
+        TArray<TSharedPtr<FJsonValue>> Regressions;
+        for (const FResult& R : Results)
+        {
+            const TSharedPtr<FJsonObject>* Old = BaselineCases.Find(CaseKey(*R.Name, R.NumSlots, R.NumEnemies));
+            if (!Old) continue;
+
+            const double OldP50 = (*Old)->GetNumberField(TEXT("P50Ms"));
+            const double OldP90 = (*Old)->GetNumberField(TEXT("P90Ms"));
+            if (R.P50 > OldP50 * (1.0 + Threshold) || R.P90 > OldP90 * (1.0 + Threshold))
+            {
+                UE_LOG(LogBunkerBench, Error, TEXT("Regression: %s slots=%d enemies=%d p50 %.4f -> %.4fms, p90 %.4f -> %.4fms"),
+                    *R.Name, R.NumSlots, R.NumEnemies, OldP50, R.P50, OldP90, R.P90);
+                Regressions.Add(MakeShared<FJsonValueString>(CaseKey(*R.Name, R.NumSlots, R.NumEnemies)));
+            }
+        }
+
+        Report->SetStringField(TEXT("Baseline"), BaselinePath);
+        Report->SetNumberField(TEXT("Threshold"), Threshold);
+        Report->SetArrayField(TEXT("Regressions"), Regressions);
+        ExitCode = Regressions.Num() > 0 ? 1 : 0;
+    }
+
+    FString OutputPath;
+    if (!FParse::Value(*Params, TEXT("Output="), OutputPath))
+    {
+        OutputPath = FPaths::ProfilingDir() / TEXT("BunkerBench") / FString::Printf(TEXT("AdvisorBenchmark_%s.json"), *FDateTime::Now().ToString());
+    }
+
+    FString Json;
+    FJsonSerializer::Serialize(Report, TJsonWriterFactory<>::Create(&Json));
+    if (!FFileHelper::SaveStringToFile(Json, *OutputPath))
+    {
+        UE_LOG(LogBunkerBench, Error, TEXT("Could not write %s"), *OutputPath);
+        return 1;
+    }
+    UE_LOG(LogBunkerBench, Display, TEXT("Wrote %s"), *OutputPath);
+
+    return ExitCode;
+}
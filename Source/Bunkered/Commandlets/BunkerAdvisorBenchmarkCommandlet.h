@@ -0,0 +1,28 @@
+// Commandlets/BunkerAdvisorBenchmarkCommandlet.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BunkerAdvisorBenchmarkCommandlet.generated.h"
+
+/**
+ * Scaling benchmark for cover suggestion latency. Builds procedural bunker fields in a transient world and times
+ * UBunkerAdvisorComponent::UpdateSuggestion and ABunkeredCharacter::FindNearbyBunkerAndSlot for every
+ * (slot count, enemy count) pair:
+ *
+ *   UnrealEditor-Cmd Bunkered.uproject -run=BunkerAdvisorBenchmark -nullrhi -unattended
+ *
+ * Writes Saved/Profiling/BunkerBench/AdvisorBenchmark_<Timestamp>.json with p50/p90/p99/max in ms per case.
+ * Optional: -Slots=10,100,1000,10000 -Enemies=0,5,10,20 -Iterations=200 -Output=<path>
+ *           -Baseline=<previous report> -Threshold=0.15 (fails with exit code 1 if any p50/p90 regresses beyond it)
+ */
+UCLASS()
+class BUNKERED_API UBunkerAdvisorBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UBunkerAdvisorBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
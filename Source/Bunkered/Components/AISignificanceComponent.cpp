@@ -0,0 +1,231 @@
+// Components/AISignificanceComponent.cpp
+#include "Components/AISignificanceComponent.h"
+#include "BrainComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "SignificanceManager.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("AI at High"), STAT_AILOD_High, STATGROUP_AILOD);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("AI at Medium"), STAT_AILOD_Medium, STATGROUP_AILOD);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("AI at Low"), STAT_AILOD_Low, STATGROUP_AILOD);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("AI at Dormant"), STAT_AILOD_Dormant, STATGROUP_AILOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tier transitions"), STAT_AILOD_Transitions, STATGROUP_AILOD);
+
+const FName UAISignificanceComponent::SignificanceTag(TEXT("AI"));
+
+namespace AISignificance
+{
+    constexpr int32 NumTiers = static_cast<int32>(EAISignificanceTier::Num);
+
+    /**
+     * Significance is (NumTiers - 1 - Tier) plus a closeness fraction in [0, 1), so the manager's
+     * max-over-viewpoints and sorting both work and the tier is recovered with a floor.
+     */
+    float TierToSignificance(EAISignificanceTier Tier, float Closeness)
+    {
+        return static_cast<float>(NumTiers - 1 - static_cast<int32>(Tier)) + FMath::Clamp(Closeness, 0.f, 0.999f);
+    }
+
+    EAISignificanceTier SignificanceToTier(float Significance)
+    {
+        const int32 Level = FMath::Clamp(FMath::FloorToInt32(Significance), 0, NumTiers - 1);
+        return static_cast<EAISignificanceTier>(NumTiers - 1 - Level);
+    }
+
+    void AddTierStat(EAISignificanceTier Tier, bool bAdd)
+    {
+        switch (Tier)
+        {
+        case EAISignificanceTier::High:    if (bAdd) { INC_DWORD_STAT(STAT_AILOD_High); }    else { DEC_DWORD_STAT(STAT_AILOD_High); }    break;
+        case EAISignificanceTier::Medium:  if (bAdd) { INC_DWORD_STAT(STAT_AILOD_Medium); }  else { DEC_DWORD_STAT(STAT_AILOD_Medium); }  break;
+        case EAISignificanceTier::Low:     if (bAdd) { INC_DWORD_STAT(STAT_AILOD_Low); }     else { DEC_DWORD_STAT(STAT_AILOD_Low); }     break;
+        case EAISignificanceTier::Dormant: if (bAdd) { INC_DWORD_STAT(STAT_AILOD_Dormant); } else { DEC_DWORD_STAT(STAT_AILOD_Dormant); } break;
+        default: break;
+        }
+    }
+}
+
+UAISignificanceComponent::UAISignificanceComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+
+    MediumTier.ActorTickInterval = 0.05f;
+    MediumTier.LogicTickInterval = 0.1f;
+    MediumTier.AnimTickInterval = 0.033f;
+    MediumTier.MovementTickInterval = 0.033f;
+
+    LowTier.ActorTickInterval = 0.2f;
+    LowTier.LogicTickInterval = 0.25f;
+    LowTier.AnimTickInterval = 0.1f;
+    LowTier.MovementTickInterval = 0.1f;
+
+    DormantTier.ActorTickInterval = 0.5f;
+    DormantTier.LogicTickInterval = 1.f;
+    DormantTier.AnimTickInterval = 0.5f;
+    DormantTier.MovementTickInterval = 0.5f;
+    DormantTier.bOnlyTickPoseWhenRendered = true;
+    DormantTier.bFreezeGroundedMovement = true;
+}
+
+const FAISignificanceTierSettings& UAISignificanceComponent::GetTierSettings(EAISignificanceTier InTier) const
+{
+    switch (InTier)
+    {
+    case EAISignificanceTier::Medium:  return MediumTier;
+    case EAISignificanceTier::Low:     return LowTier;
+    case EAISignificanceTier::Dormant: return DormantTier;
+    default:                           return HighTier;
+    }
+}
+
+void UAISignificanceComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    AActor* Owner = GetOwner();
+    BaseActorTickInterval = Owner->GetActorTickInterval();
+
+    if (const ACharacter* Character = Cast<ACharacter>(Owner))
+    {
+        Mesh = Character->GetMesh();
+        Movement = Character->GetCharacterMovement();
+    }
+    if (Mesh.IsValid())
+    {
+        BaseAnimTickInterval = Mesh->GetComponentTickInterval();
+        BaseAnimTickOption = Mesh->VisibilityBasedAnimTickOption;
+    }
+    if (Movement.IsValid())
+    {
+        BaseMovementTickInterval = Movement->GetComponentTickInterval();
+    }
+
+    Tier = EAISignificanceTier::High;
+    if (!bSuspended)
+    {
+        Register();
+    }
+}
+
+void UAISignificanceComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (!bSuspended)
+    {
+        Unregister();
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UAISignificanceComponent::SetSuspended(bool bSuspend)
+{
+    if (bSuspend == bSuspended) return;
+    bSuspended = bSuspend;
+
+    // Before BeginPlay there's nothing to undo; BeginPlay checks the flag
+    if (!HasBegunPlay()) return;
+
+    if (bSuspended)
+    {
+        Unregister();
+    }
+    else
+    {
+        Register();
+        ApplyTier();
+    }
+}
+
+void UAISignificanceComponent::Register()
+{
+    AISignificance::AddTierStat(Tier, true);
+
+    if (USignificanceManager* SigMan = USignificanceManager::Get(GetWorld()))
+    {
+        SigMan->RegisterObject(this, SignificanceTag,
+            [this](USignificanceManager::FManagedObjectInfo*, const FTransform& Viewpoint) { return CalcSignificance(Viewpoint); },
+            USignificanceManager::EPostSignificanceType::Sequential,
+            [this](USignificanceManager::FManagedObjectInfo*, float, float Significance, bool) { SetTier(AISignificance::SignificanceToTier(Significance)); });
+    }
+}
+
+void UAISignificanceComponent::Unregister()
+{
+    if (USignificanceManager* SigMan = USignificanceManager::Get(GetWorld()))
+    {
+        SigMan->UnregisterObject(this);
+    }
+    AISignificance::AddTierStat(Tier, false);
+}
+
+float UAISignificanceComponent::CalcSignificance(const FTransform& Viewpoint) const
+{
+    const FVector ToOwner = GetOwner()->GetActorLocation() - Viewpoint.GetLocation();
+    float Distance = ToOwner.Size();
+
+    // Behind the viewer counts as further away
+    const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(ViewHalfAngle));
+    if (FVector::DotProduct(Viewpoint.GetUnitAxis(EAxis::X), ToOwner) < CosHalfAngle * Distance)
+    {
+        Distance *= UnseenDistanceScale;
+    }
+
+    EAISignificanceTier DistanceTier = EAISignificanceTier::High;
+    if (Distance >= DormantDistance)     DistanceTier = EAISignificanceTier::Dormant;
+    else if (Distance >= LowDistance)    DistanceTier = EAISignificanceTier::Low;
+    else if (Distance >= MediumDistance) DistanceTier = EAISignificanceTier::Medium;
+
+    const float Closeness = 1.f - Distance / FMath::Max(DormantDistance, 1.f);
+    return AISignificance::TierToSignificance(DistanceTier, Closeness);
+}
+
+void UAISignificanceComponent::SetTier(EAISignificanceTier NewTier)
+{
+    if (NewTier == Tier) return;
+
+    const EAISignificanceTier OldTier = Tier;
+    AISignificance::AddTierStat(OldTier, false);
+    AISignificance::AddTierStat(NewTier, true);
+    INC_DWORD_STAT(STAT_AILOD_Transitions);
+
+    Tier = NewTier;
+    ApplyTier();
+    OnTierChanged.Broadcast(OldTier, NewTier);
+}
+
+void UAISignificanceComponent::ApplyTier()
+{
+    const FAISignificanceTierSettings& Settings = GetTierSettings(Tier);
+
+    GetOwner()->SetActorTickInterval(FMath::Max(BaseActorTickInterval, Settings.ActorTickInterval));
+
+    if (UActorComponent* Logic = FindLogicComponent())
+    {
+        Logic->SetComponentTickInterval(Settings.LogicTickInterval);
+    }
+
+    if (USkeletalMeshComponent* SkelMesh = Mesh.Get())
+    {
+        SkelMesh->SetComponentTickInterval(FMath::Max(BaseAnimTickInterval, Settings.AnimTickInterval));
+        SkelMesh->VisibilityBasedAnimTickOption = Settings.bOnlyTickPoseWhenRendered
+            ? EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered
+            : BaseAnimTickOption;
+    }
+
+    if (UCharacterMovementComponent* CMC = Movement.Get())
+    {
+        CMC->SetComponentTickInterval(FMath::Max(BaseMovementTickInterval, Settings.MovementTickInterval));
+
+        // Never freeze mid-air; a dormant AI left hanging would be obvious the moment it wakes
+        const bool bFreeze = Settings.bFreezeGroundedMovement && CMC->IsMovingOnGround();
+        CMC->SetComponentTickEnabled(!bFreeze);
+    }
+}
+
+UActorComponent* UAISignificanceComponent::FindLogicComponent() const
+{
+    const APawn* Pawn = Cast<APawn>(GetOwner());
+    const AController* Controller = Pawn ? Pawn->GetController() : nullptr;
+    return Controller ? Controller->FindComponentByClass<UBrainComponent>() : nullptr;
+}
@@ -0,0 +1,134 @@
+// Components/AISignificanceComponent.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "AISignificanceComponent.generated.h"
+
+class UCharacterMovementComponent;
+class USkeletalMeshComponent;
+
+DECLARE_STATS_GROUP(TEXT("AI LOD"), STATGROUP_AILOD, STATCAT_Advanced);
+
+/** AI level of detail, most significant first */
+UENUM(BlueprintType)
+enum class EAISignificanceTier : uint8
+{
+    High     UMETA(DisplayName="High"),
+    Medium   UMETA(DisplayName="Medium"),
+    Low      UMETA(DisplayName="Low"),
+    Dormant  UMETA(DisplayName="Dormant"),
+    Num      UMETA(Hidden)
+};
+
+/** What an AI is allowed to run at one significance tier. Intervals never go below the authored ones. */
+USTRUCT(BlueprintType)
+struct FAISignificanceTierSettings
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Significance", meta=(ClampMin="0.0", Units="s"))
+    float ActorTickInterval = 0.f;
+
+    /** StateTree / brain component tick interval on the owning controller */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Significance", meta=(ClampMin="0.0", Units="s"))
+    float LogicTickInterval = 0.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Significance", meta=(ClampMin="0.0", Units="s"))
+    float AnimTickInterval = 0.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Significance", meta=(ClampMin="0.0", Units="s"))
+    float MovementTickInterval = 0.f;
+
+    /** Skip pose evaluation entirely when nobody can see the mesh */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Significance")
+    bool bOnlyTickPoseWhenRendered = false;
+
+    /** Stop simulating CharacterMovement while grounded */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Significance")
+    bool bFreezeGroundedMovement = false;
+};
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnAISignificanceTierChanged, EAISignificanceTier /*Old*/, EAISignificanceTier /*New*/);
+
+/**
+ * Registers its owning AI character with the significance manager and scales the actor, controller logic,
+ * animation and movement tick rates down as the character gets further from (or behind) every player.
+ * Viewpoints are fed to the manager by UAISignificanceSubsystem.
+ */
+UCLASS(ClassGroup=(AI), meta=(BlueprintSpawnableComponent))
+class BUNKERED_API UAISignificanceComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UAISignificanceComponent();
+
+    UFUNCTION(BlueprintPure, Category="Significance")
+    EAISignificanceTier GetTier() const { return Tier; }
+
+    const FAISignificanceTierSettings& GetTierSettings(EAISignificanceTier InTier) const;
+
+    /** Takes the owner out of (or back into) significance updates, e.g. while it sits in a pool. Resuming re-applies the tier. */
+    void SetSuspended(bool bSuspend);
+
+    FOnAISignificanceTierChanged OnTierChanged;
+
+    /** Distance at which each tier below High begins */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Significance", meta=(ClampMin="0.0", Units="cm"))
+    float MediumDistance = 2000.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Significance", meta=(ClampMin="0.0", Units="cm"))
+    float LowDistance = 5000.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Significance", meta=(ClampMin="0.0", Units="cm"))
+    float DormantDistance = 10000.f;
+
+    /** Distance multiplier for AI outside a viewer's view cone */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Significance", meta=(ClampMin="1.0"))
+    float UnseenDistanceScale = 2.f;
+
+    /** Half-angle of the view cone used for the unseen test */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Significance", meta=(ClampMin="0.0", ClampMax="180.0", Units="deg"))
+    float ViewHalfAngle = 60.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Significance|Tiers")
+    FAISignificanceTierSettings HighTier;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Significance|Tiers")
+    FAISignificanceTierSettings MediumTier;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Significance|Tiers")
+    FAISignificanceTierSettings LowTier;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Significance|Tiers")
+    FAISignificanceTierSettings DormantTier;
+
+    /** Tag the owner is registered under with the significance manager */
+    static const FName SignificanceTag;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+    EAISignificanceTier Tier = EAISignificanceTier::High;
+    bool bSuspended = false;
+
+    /** Authored values captured at BeginPlay, restored at High */
+    float BaseActorTickInterval = 0.f;
+    float BaseAnimTickInterval = 0.f;
+    float BaseMovementTickInterval = 0.f;
+    EVisibilityBasedAnimTickOption BaseAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPose;
+
+    TWeakObjectPtr<USkeletalMeshComponent> Mesh;
+    TWeakObjectPtr<UCharacterMovementComponent> Movement;
+
+    void Register();
+    void Unregister();
+    float CalcSignificance(const FTransform& Viewpoint) const;
+    void SetTier(EAISignificanceTier NewTier);
+    void ApplyTier();
+    UActorComponent* FindLogicComponent() const;
+};
@@ -4,7 +4,8 @@
 #include "Bunkers/BunkerBase.h"
 #include "Components/DecalComponent.h"
 #include "GameFramework/Character.h"
-#include "Kismet/GameplayStatics.h"
+#include "Subsystems/BunkerSlotSubsystem.h"
+#include "Utility/BunkerProfiling.h"
 
 UBunkerAdvisorComponent::UBunkerAdvisorComponent()
 {
@@ -13,7 +14,8 @@ UBunkerAdvisorComponent::UBunkerAdvisorComponent()
 
 void UBunkerAdvisorComponent::UpdateIndicator()
 {
-    if (!bShowSuggestionIndicator)
+    // Nobody to see it on a dedicated server (e.g. headless bot runs)
+    if (!bShowSuggestionIndicator || GetNetMode() == NM_DedicatedServer)
     {
         ClearIndicator();
         return;
@@ -28,6 +30,7 @@ void UBunkerAdvisorComponent::UpdateIndicator()
     // Create decal lazily
     if (!SuggestDecal)
     {
+        LLM_SCOPE_BYTAG(Bunker_Advisor);
         SuggestDecal = NewObject<UDecalComponent>(GetOwner());
         if (!SuggestDecal) return;
         SuggestDecal->RegisterComponent();
@@ -64,6 +67,7 @@ void UBunkerAdvisorComponent::BeginPlay()
     {
         CoverComp = OwnerCharacter->FindComponentByClass<UBunkerCoverComponent>();
     }
+    SlotStore = GetWorld()->GetSubsystem<UBunkerSlotSubsystem>();
     // Sync BP-provided enemies into weak refs once
     KnownEnemies.Reset();
     for (AActor* E : KnownEnemies_BP)
@@ -74,17 +78,21 @@ void UBunkerAdvisorComponent::BeginPlay()
 
 bool UBunkerAdvisorComponent::UpdateSuggestion()
 {
+    CSV_SCOPED_TIMING_STAT(Bunker, AdvisorUpdate);
+
     if (bManualOverride && SuggestedCandidate.IsValid())
     {
         SuggestedCandidate.SlotTransform = SuggestedCandidate.Bunker->GetSlotWorldTransform(SuggestedCandidate.SlotIndex);
         return true;
     }
 
-    TArray<FBunkerCandidate> Candidates;
-    GatherCandidates(Candidates);
+    {
+        LLM_SCOPE_BYTAG(Bunker_Advisor);
+        GatherCandidates(CandidateScratch);
+    }
 
     FBunkerCandidate Best; float BestScore = -FLT_MAX;
-    for (const FBunkerCandidate& C : Candidates)
+    for (const FBunkerCandidate& C : CandidateScratch)
     {
         const float S = ScoreCandidate(C);
         if (S > BestScore)
@@ -95,6 +103,99 @@ bool UBunkerAdvisorComponent::UpdateSuggestion()
         }
     }
 
+    ApplySuggestion(Best);
+    return SuggestedCandidate.IsValid();
+}
+
+bool UBunkerAdvisorComponent::UpdateSuggestionAsync()
+{
+    CSV_SCOPED_TIMING_STAT(Bunker, AdvisorUpdate);
+
+    if (bManualOverride && SuggestedCandidate.IsValid())
+    {
+        return UpdateSuggestion();
+    }
+
+    // A newer request supersedes any traces still in flight
+    ++AsyncSerial;
+    AsyncPendingTraces = 0;
+
+    {
+        LLM_SCOPE_BYTAG(Bunker_Advisor);
+        GatherCandidates(AsyncCandidates);
+        AsyncExposed.Init(false, AsyncCandidates.Num());
+    }
+    if (AsyncCandidates.Num() == 0)
+    {
+        ApplySuggestion(FBunkerCandidate());
+        return false;
+    }
+
+    FTraceDelegate TraceDelegate = FTraceDelegate::CreateUObject(this, &UBunkerAdvisorComponent::OnExposureTraceDone, AsyncSerial);
+    for (int32 i = 0; i < AsyncCandidates.Num(); ++i)
+    {
+        const FVector SlotLoc = AsyncCandidates[i].SlotTransform.GetLocation();
+        for (const TWeakObjectPtr<AActor>& Enemy : KnownEnemies)
+        {
+            if (!Enemy.IsValid()) continue;
+
+            const FVector Eye = Enemy->GetActorLocation() + FVector(0,0,60.f);
+            FCollisionQueryParams Params(SCENE_QUERY_STAT(BunkerAdvVisAsync), false, Enemy.Get());
+            GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, Eye, SlotLoc, VisibilityChannel, Params,
+                FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, static_cast<uint32>(i));
+            ++AsyncPendingTraces;
+        }
+    }
+    BUNKER_COUNTER_ADD(TracesIssued, AsyncPendingTraces);
+
+    // No enemies to trace against: score right away
+    if (AsyncPendingTraces == 0)
+    {
+        FinishAsyncSuggestion();
+    }
+    return true;
+}
+
+void UBunkerAdvisorComponent::OnExposureTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum, uint32 Serial)
+{
+    if (Serial != AsyncSerial || !AsyncExposed.IsValidIndex(Datum.UserData)) return;
+
+    // Same rule as IsSlotExposedToEnemies: clear line, or only the candidate bunker itself in the way
+    const FHitResult* Hit = Datum.OutHits.Num() ? &Datum.OutHits[0] : nullptr;
+    const FBunkerCandidate& Candidate = AsyncCandidates[Datum.UserData];
+    if (!Hit || !Hit->bBlockingHit || (Candidate.Bunker && Candidate.Bunker->IsSlotOwnCover(Candidate.SlotIndex, *Hit)))
+    {
+        AsyncExposed[Datum.UserData] = true;
+    }
+
+    if (--AsyncPendingTraces == 0)
+    {
+        FinishAsyncSuggestion();
+    }
+}
+
+void UBunkerAdvisorComponent::FinishAsyncSuggestion()
+{
+    FBunkerCandidate Best; float BestScore = -FLT_MAX;
+    for (int32 i = 0; i < AsyncCandidates.Num(); ++i)
+    {
+        // Slot may have gone away while traces were in flight
+        if (!IsValid(AsyncCandidates[i].Bunker)) continue;
+
+        const float S = ScoreCandidate(AsyncCandidates[i], AsyncExposed[i]);
+        if (S > BestScore)
+        {
+            BestScore = S;
+            Best = AsyncCandidates[i];
+            Best.Score = S;
+        }
+    }
+
+    ApplySuggestion(Best);
+}
+
+void UBunkerAdvisorComponent::ApplySuggestion(const FBunkerCandidate& Best)
+{
     const bool bChanged =
         (Best.Bunker != SuggestedCandidate.Bunker) ||
         (Best.SlotIndex != SuggestedCandidate.SlotIndex);
@@ -103,6 +204,7 @@ bool UBunkerAdvisorComponent::UpdateSuggestion()
 
     if (bChanged && SuggestedCandidate.IsValid())
     {
+        BUNKER_COUNTER_ADD(SuggestionsChanged, 1);
         OnSuggestedBunkerChanged.Broadcast(SuggestedCandidate);
         UpdateIndicator();
     }
@@ -110,8 +212,15 @@ bool UBunkerAdvisorComponent::UpdateSuggestion()
     {
         ClearIndicator();
     }
+}
 
-    return SuggestedCandidate.IsValid();
+void UBunkerAdvisorComponent::SetKnownEnemies(TConstArrayView<AActor*> Enemies)
+{
+    KnownEnemies.Reset();
+    for (AActor* E : Enemies)
+    {
+        if (E) KnownEnemies.Add(E);
+    }
 }
 
 bool UBunkerAdvisorComponent::AcceptSuggestion()
@@ -160,49 +269,73 @@ void UBunkerAdvisorComponent::ClearManualSuggestion()
     bManualOverride = false;
 }
 
-void UBunkerAdvisorComponent::GatherCandidates(TArray<FBunkerCandidate>& Out) const
+#if WITH_GAMEPLAY_DEBUGGER
+void UBunkerAdvisorComponent::GetDebugCandidates(TArray<FBunkerCandidate>& Out) const
+{
+    GatherCandidates(Out, false);
+    for (FBunkerCandidate& C : Out)
+    {
+        C.Score = ScoreCandidate(C, IsSlotExposedToEnemies(C, false));
+    }
+    Out.Sort([](const FBunkerCandidate& A, const FBunkerCandidate& B) { return A.Score > B.Score; });
+}
+#endif
+
+void UBunkerAdvisorComponent::GatherCandidates(TArray<FBunkerCandidate>& Out, bool bCountStats) const
 {
+    BUNKER_SCOPE_CYCLE_COUNTER(STAT_Bunker_GatherCandidates);
+
     Out.Reset();
-    if (!OwnerCharacter.IsValid()) return;
+    if (!OwnerCharacter.IsValid() || !SlotStore.IsValid()) return;
 
     const FVector Origin = OwnerCharacter->GetActorLocation();
     const float R2 = FMath::Square(SearchRadius);
 
-    // Identify current bunker to EXCLUDE entirely
+    // Identify current cover to EXCLUDE entirely
     ABunkerBase* CurrentB = nullptr;
+    int32 CurrentSlot = INDEX_NONE;
     if (CoverComp.IsValid() && CoverComp->IsInCover())
     {
         CurrentB = CoverComp->GetCurrentBunker();
+        CurrentSlot = CoverComp->GetCurrentSlot();
     }
 
-    TArray<AActor*> Bunkers;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), ABunkerBase::StaticClass(), Bunkers);
-
-    for (AActor* A : Bunkers)
+    // Range test over the packed slot locations; only slots in range touch their bunker
+    const TConstArrayView<FVector> Locations = SlotStore->GetLocations();
+    for (int32 SlotId = 0; SlotId < Locations.Num(); ++SlotId)
     {
-        ABunkerBase* B = Cast<ABunkerBase>(A);
-        if (!B || B->GetNumSlots() <= 0) continue;
+        if (FVector::DistSquared(Origin, Locations[SlotId]) > R2) continue;
 
-        // HARD EXCLUDE: never suggest the bunker we’re currently in
-        if (B == CurrentB) continue;
+        ABunkerBase* B = SlotStore->GetBunker(SlotId);
 
-        for (int32 i = 0; i < B->GetNumSlots(); ++i)
-        {
-            const FTransform WT = B->GetSlotWorldTransform(i);
-            const FVector Loc = WT.GetLocation();
-            if (FVector::DistSquared(Origin, Loc) > R2) continue;
-
-            FBunkerCandidate C;
-            C.Bunker = B;
-            C.SlotIndex = i;
-            C.SlotTransform = WT;
-            Out.Add(C);
-        }
+        if (!B) continue; // unregistered slot
+
+        // HARD EXCLUDE: never suggest the cover we’re currently in (a placed bunker, not the whole generated field)
+        const int32 LocalIndex = SlotStore->GetLocalIndex(SlotId);
+        if (B == CurrentB && B->IsSameCover(CurrentSlot, LocalIndex)) continue;
+
+        FBunkerCandidate& C = Out.AddDefaulted_GetRef();
+        C.Bunker = B;
+        C.SlotIndex = LocalIndex;
+        C.SlotId = SlotId;
+        C.SlotTransform = FTransform(SlotStore->GetForward(SlotId).Rotation(), Locations[SlotId]);
+    }
+
+    if (bCountStats)
+    {
+        BUNKER_COUNTER_ADD(CandidatesGathered, Out.Num());
     }
 }
 
 float UBunkerAdvisorComponent::ScoreCandidate(const FBunkerCandidate& Candidate) const
 {
+    return ScoreCandidate(Candidate, IsSlotExposedToEnemies(Candidate));
+}
+
+float UBunkerAdvisorComponent::ScoreCandidate(const FBunkerCandidate& Candidate, bool bExposed) const
+{
+    BUNKER_SCOPE_CYCLE_COUNTER(STAT_Bunker_ScoreCandidate);
+
     if (!OwnerCharacter.IsValid()) return -FLT_MAX;
 
     const FVector From = OwnerCharacter->GetActorLocation();
@@ -217,7 +350,7 @@ float UBunkerAdvisorComponent::ScoreCandidate(const FBunkerCandidate& Candidate)
     Score += Weights.ForwardBias * ForwardAlignmentBonus(From, To);
 
     // Exposure penalty
-    if (IsSlotExposedToEnemies(Candidate))
+    if (bExposed)
     {
         Score -= Weights.ExposedPenalty;
     }
@@ -225,9 +358,10 @@ float UBunkerAdvisorComponent::ScoreCandidate(const FBunkerCandidate& Candidate)
     // Stance comfort
     if (CoverComp.IsValid())
     {
-        const ECoverStance Current = CoverComp->GetStance();
-        const FCoverSlot& Slot = Candidate.Bunker->GetSlot(Candidate.SlotIndex);
-        if (Slot.AllowedStances.Num() == 0 || Slot.AllowedStances.Contains(Current))
+        const uint8 StanceMask = (SlotStore.IsValid() && Candidate.SlotId != INDEX_NONE)
+            ? SlotStore->GetStanceMask(Candidate.SlotId)
+            : Candidate.Bunker->GetSlot(Candidate.SlotIndex).StanceMask;
+        if (StanceMask & CoverStanceBit(CoverComp->GetStance()))
         {
             Score += Weights.StanceComfortBonus;
         }
@@ -260,9 +394,11 @@ float UBunkerAdvisorComponent::ForwardAlignmentBonus(const FVector& From, const
     return FMath::Clamp(FVector::DotProduct(Forward, Dir), -1.f, 1.f);
 }
 
-bool UBunkerAdvisorComponent::IsSlotExposedToEnemies(const FBunkerCandidate& Candidate) const
+bool UBunkerAdvisorComponent::IsSlotExposedToEnemies(const FBunkerCandidate& Candidate, bool bCountStats) const
 {
-    if (KnownEnemies.Num() == 0) return false;
+    BUNKER_SCOPE_CYCLE_COUNTER(STAT_Bunker_IsSlotExposed);
+
+    if (KnownEnemies.Num() == 0 || !Candidate.Bunker) return false;
 
     const FVector SlotLoc = Candidate.SlotTransform.GetLocation();
 
@@ -275,9 +411,13 @@ bool UBunkerAdvisorComponent::IsSlotExposedToEnemies(const FBunkerCandidate& Can
         FCollisionQueryParams Params(SCENE_QUERY_STAT(BunkerAdvVis), false, Enemy.Get());
 
         const bool bHit = GetWorld()->LineTraceSingleByChannel(HR, Eye, SlotLoc, VisibilityChannel, Params);
+        if (bCountStats)
+        {
+            BUNKER_COUNTER_ADD(TracesIssued, 1);
+        }
 
         // If line is clear, or hits the candidate bunker itself, consider exposed
-        if (!bHit || HR.GetActor() == Candidate.Bunker.Get())
+        if (!bHit || Candidate.Bunker->IsSlotOwnCover(Candidate.SlotIndex, HR))
         {
             return true;
         }
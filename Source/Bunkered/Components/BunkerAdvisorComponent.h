@@ -4,11 +4,13 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Types/CoverTypes.h"
+#include "WorldCollision.h"
 #include "BunkerAdvisorComponent.generated.h"
 
 class ABunkerBase;
 class UBunkerCoverComponent;
 class ACharacter;
+class UBunkerSlotSubsystem;
 
 /** Tunable weights for scoring bunker candidates */
 USTRUCT(BlueprintType)
@@ -43,6 +45,9 @@ struct FBunkerCandidate
     UPROPERTY(BlueprintReadOnly) float Score = -FLT_MAX;
     UPROPERTY(BlueprintReadOnly) FTransform SlotTransform = FTransform::Identity;
 
+    /** Id in the world slot store (UBunkerSlotSubsystem), INDEX_NONE for manual suggestions */
+    int32 SlotId = INDEX_NONE;
+
     bool IsValid() const { return Bunker != nullptr && SlotIndex != INDEX_NONE; }
 };
 
@@ -64,9 +69,32 @@ public:
     UFUNCTION(BlueprintCallable, Category="Bunker|Advise")
     bool UpdateSuggestion();
 
+    /**
+     * Same scoring as UpdateSuggestion, but enemy exposure is checked with async traces.
+     * The result lands in GetSuggestion() once IsSuggestionPending() returns false. Returns false if nothing to score.
+     */
+    bool UpdateSuggestionAsync();
+
+    bool IsSuggestionPending() const { return AsyncPendingTraces > 0; }
+
+    /** Candidate slots the reusable buffers can hold without growing, and their heap bytes (Bunker.MemReport) */
+    int32 GetScratchCapacity() const { return CandidateScratch.Max() + AsyncCandidates.Max(); }
+    SIZE_T GetScratchAllocatedSize() const
+    {
+        return CandidateScratch.GetAllocatedSize() + AsyncCandidates.GetAllocatedSize() + AsyncExposed.GetAllocatedSize();
+    }
+
+    /** Replaces the enemies used for exposure scoring */
+    void SetKnownEnemies(TConstArrayView<AActor*> Enemies);
+
     UFUNCTION(BlueprintPure, Category="Bunker|Advise")
     FBunkerCandidate GetSuggestion() const { return SuggestedCandidate; }
 
+#if WITH_GAMEPLAY_DEBUGGER
+    /** Every candidate in range, scored with sync exposure traces and sorted best first. Gameplay debugger only. */
+    void GetDebugCandidates(TArray<FBunkerCandidate>& Out) const;
+#endif
+
     /** Accept current suggestion. If far, broadcasts OnBeginTraverseTo. If close, enters cover. */
     UFUNCTION(BlueprintCallable, Category="Bunker|Advise")
     bool AcceptSuggestion();
@@ -125,6 +153,7 @@ protected:
 private:
     TWeakObjectPtr<ACharacter> OwnerCharacter;
     TWeakObjectPtr<UBunkerCoverComponent> CoverComp;
+    TWeakObjectPtr<UBunkerSlotSubsystem> SlotStore;
 
     // internal weak refs for scoring (safer than raw pointers at runtime)
     TArray<TWeakObjectPtr<AActor>> KnownEnemies;
@@ -132,9 +161,26 @@ private:
     FBunkerCandidate SuggestedCandidate;
     bool bManualOverride = false;
 
-    void GatherCandidates(TArray<FBunkerCandidate>& Out) const;
+    /** Reused by UpdateSuggestion so a refresh doesn't allocate */
+    UPROPERTY(Transient)
+    TArray<FBunkerCandidate> CandidateScratch;
+
+    // async suggestion state
+    UPROPERTY(Transient)
+    TArray<FBunkerCandidate> AsyncCandidates;
+    TArray<bool> AsyncExposed;
+    int32 AsyncPendingTraces = 0;
+    uint32 AsyncSerial = 0;
+
+    void OnExposureTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum, uint32 Serial);
+    void FinishAsyncSuggestion();
+    void ApplySuggestion(const FBunkerCandidate& Best);
+
+    /** bCountStats=false keeps debug-only queries out of the Bunker counters */
+    void GatherCandidates(TArray<FBunkerCandidate>& Out, bool bCountStats = true) const;
     float ScoreCandidate(const FBunkerCandidate& Candidate) const;
-    bool  IsSlotExposedToEnemies(const FBunkerCandidate& Candidate) const;
+    float ScoreCandidate(const FBunkerCandidate& Candidate, bool bExposed) const;
+    bool  IsSlotExposedToEnemies(const FBunkerCandidate& Candidate, bool bCountStats = true) const;
 
     float DistancePenalty(const FVector& From, const FVector& To) const;
     float ForwardAlignmentBonus(const FVector& From, const FVector& To) const;
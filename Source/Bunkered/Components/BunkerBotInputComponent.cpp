@@ -0,0 +1,148 @@
+// Components/BunkerBotInputComponent.cpp
+#include "Components/BunkerBotInputComponent.h"
+#include "Components/BunkerAdvisorComponent.h"
+#include "Components/BunkerCoverComponent.h"
+#include "Characters/BunkeredCharacter.h"
+#include "Interface/BunkerCoverInterface.h"
+
+namespace BunkerBotInput
+{
+    // Relative weights of in-cover actions
+    constexpr int32 TraverseWeight = 35;
+    constexpr int32 PeekWeight     = 30;
+    constexpr int32 StanceWeight   = 10;
+    constexpr int32 AdvisorWeight  = 15;
+    constexpr int32 ExitWeight     = 10;
+
+    /** Out of cover: chance to ask the advisor rather than entering the nearest slot directly */
+    constexpr float AdvisorOutOfCoverChance = 0.7f;
+}
+
+UBunkerBotInputComponent::UBunkerBotInputComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.TickInterval = 0.1f; // input cadence, not per frame
+}
+
+void UBunkerBotInputComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (!GetOwner()->HasAuthority() || !GetOwner()->GetClass()->ImplementsInterface(UBunkerCoverInterface::StaticClass()))
+    {
+        SetComponentTickEnabled(false);
+        return;
+    }
+
+    if (RandomSeed != 0) Stream.Initialize(RandomSeed);
+    else Stream.GenerateNewSeed();
+
+    // Stagger the first input so a wave of bots doesn't act on the same frame
+    TimeToNextAction = Stream.FRandRange(0.f, ActionInterval);
+}
+
+void UBunkerBotInputComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    AActor* Pawn = GetOwner();
+
+    if (TimeToRelease > 0.f)
+    {
+        TimeToRelease -= DeltaTime;
+        if (TimeToRelease <= 0.f) ReleaseHeld(Pawn);
+    }
+
+    TimeToNextAction -= DeltaTime;
+    if (TimeToNextAction > 0.f) return;
+    TimeToNextAction = FMath::Max(ActionInterval + Stream.FRandRange(-ActionJitter, ActionJitter), 0.05f);
+
+    // Let an auto-traverse finish before pressing anything else
+    if (const ABunkeredCharacter* Character = Cast<ABunkeredCharacter>(Pawn))
+    {
+        if (Character->PendingBunker.IsValid()) return;
+    }
+
+    const UBunkerCoverComponent* Cover = Pawn->FindComponentByClass<UBunkerCoverComponent>();
+    if (Cover && Cover->IsInCover()) ActInCover(Pawn);
+    else ActOutOfCover(Pawn);
+
+    ++NumActions;
+}
+
+void UBunkerBotInputComponent::ActOutOfCover(AActor* Pawn)
+{
+    // Same path as ABunkeredPlayerController::OnEnterSlotOnBunker: advisor first, nearest slot as fallback
+    if (Stream.FRand() < BunkerBotInput::AdvisorOutOfCoverChance)
+    {
+        if (UBunkerAdvisorComponent* Advisor = Pawn->FindComponentByClass<UBunkerAdvisorComponent>())
+        {
+            Advisor->UpdateSuggestion();
+            if (Advisor->AcceptSuggestion()) return;
+        }
+    }
+
+    IBunkerCoverInterface::Execute_EnterSlotOnBunker(Pawn);
+}
+
+void UBunkerBotInputComponent::ActInCover(AActor* Pawn)
+{
+    using namespace BunkerBotInput;
+
+    // Never stack a new peek on an unreleased one
+    ReleaseHeld(Pawn);
+
+    int32 Roll = Stream.RandRange(0, TraverseWeight + PeekWeight + StanceWeight + AdvisorWeight + ExitWeight - 1);
+
+    if ((Roll -= TraverseWeight) < 0)
+    {
+        IBunkerCoverInterface::Execute_SlotTransition(Pawn, Stream.RandBool() ? 1 : -1);
+    }
+    else if ((Roll -= PeekWeight) < 0)
+    {
+        HeldPeek = static_cast<EPeekDirection>(Stream.RandRange(static_cast<int32>(EPeekDirection::Left), static_cast<int32>(EPeekDirection::Over)));
+        IBunkerCoverInterface::Execute_SlotPeek(Pawn, HeldPeek, true);
+        TimeToRelease = HoldTime;
+    }
+    else if ((Roll -= StanceWeight) < 0)
+    {
+        const ECoverStance Stance = static_cast<ECoverStance>(Stream.RandRange(static_cast<int32>(ECoverStance::Stand), static_cast<int32>(ECoverStance::Prone)));
+        IBunkerCoverInterface::Execute_SetSlotStance(Pawn, Stance);
+    }
+    else if ((Roll -= AdvisorWeight) < 0)
+    {
+        if (UBunkerAdvisorComponent* Advisor = Pawn->FindComponentByClass<UBunkerAdvisorComponent>())
+        {
+            Advisor->UpdateSuggestion();
+            Advisor->AcceptSuggestion();
+        }
+    }
+    else
+    {
+        // EnterSlotOnBunker toggles, so in cover this leaves
+        IBunkerCoverInterface::Execute_EnterSlotOnBunker(Pawn);
+        return;
+    }
+
+    if (Stream.FRand() < FireChance)
+    {
+        IBunkerCoverInterface::Execute_Pawn_Trigger(Pawn, true);
+        bTriggerHeld = true;
+        TimeToRelease = HoldTime;
+    }
+}
+
+void UBunkerBotInputComponent::ReleaseHeld(AActor* Pawn)
+{
+    if (HeldPeek != EPeekDirection::None)
+    {
+        IBunkerCoverInterface::Execute_SlotPeek(Pawn, HeldPeek, false);
+        HeldPeek = EPeekDirection::None;
+    }
+    if (bTriggerHeld)
+    {
+        IBunkerCoverInterface::Execute_Pawn_Trigger(Pawn, false);
+        bTriggerHeld = false;
+    }
+    TimeToRelease = 0.f;
+}
@@ -0,0 +1,61 @@
+// Components/BunkerBotInputComponent.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Math/RandomStream.h"
+#include "Types/CoverTypes.h"
+#include "BunkerBotInputComponent.generated.h"
+
+/**
+ * Presses the same IBunkerCoverInterface inputs a player would, at random intervals: advisor accept / enter cover
+ * when out of cover; traverse, peek, stance changes, trigger pulls and the occasional exit while in cover.
+ * Server-only; used by the soak harness to load a server without human clients.
+ */
+UCLASS(ClassGroup=(AI), meta=(BlueprintSpawnableComponent))
+class BUNKERED_API UBunkerBotInputComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UBunkerBotInputComponent();
+
+    /** Average seconds between inputs */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Bot", meta=(ClampMin="0.05", Units="s"))
+    float ActionInterval = 1.5f;
+
+    /** +/- random spread applied to ActionInterval */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Bot", meta=(ClampMin="0.0", Units="s"))
+    float ActionJitter = 0.75f;
+
+    /** How long peeks and trigger pulls are held before release */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Bot", meta=(ClampMin="0.0", Units="s"))
+    float HoldTime = 0.6f;
+
+    /** Chance that an in-cover action is also a trigger pull */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Bot", meta=(ClampMin="0.0", ClampMax="1.0"))
+    float FireChance = 0.3f;
+
+    /** Seed for the input stream; 0 picks one at random. Fixed seeds make soak runs repeatable. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Bot")
+    int32 RandomSeed = 0;
+
+    /** Inputs issued since BeginPlay */
+    int32 GetNumActions() const { return NumActions; }
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+    FRandomStream Stream;
+    float TimeToNextAction = 0.f;
+    float TimeToRelease = 0.f;
+    EPeekDirection HeldPeek = EPeekDirection::None;
+    bool bTriggerHeld = false;
+    int32 NumActions = 0;
+
+    void ActOutOfCover(AActor* Pawn);
+    void ActInCover(AActor* Pawn);
+    void ReleaseHeld(AActor* Pawn);
+};
@@ -5,9 +5,10 @@
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "GameFramework/SpringArmComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "Subsystems/BunkerSlotSubsystem.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "Utility/BunkerProfiling.h"
 #include "Utility/LoggingMacros.h"
 
 UBunkerCoverComponent::UBunkerCoverComponent()
@@ -37,15 +38,14 @@ bool UBunkerCoverComponent::IsStanceAllowedAtSlot(ECoverStance InStance, int32 S
 {
     if (!CurrentBunker || !CurrentBunker->GetNumSlots() || !ensure(CurrentBunker->GetNumSlots() > SlotIndex)) return false;
     const FCoverSlot& Slot = CurrentBunker->GetSlot(SlotIndex);
-    return Slot.AllowedStances.Contains(InStance);
+    return Slot.AllowsStance(InStance);
 }
 
 bool UBunkerCoverComponent::IsPeekAllowedAtSlot(EPeekDirection InPeek, int32 SlotIndex) const
 {
     if (InPeek == EPeekDirection::None) return true;
     if (!CurrentBunker || !ensure(CurrentBunker->GetNumSlots() > SlotIndex)) return false;
-    const FCoverSlot& Slot = CurrentBunker->GetSlot(SlotIndex);
-    return Slot.AllowedPeeks.Num() == 0 || Slot.AllowedPeeks.Contains(InPeek);
+    return CurrentBunker->GetSlot(SlotIndex).AllowsPeek(InPeek);
 }
 
 bool UBunkerCoverComponent::TryEnterCover(ABunkerBase* Bunker, int32 SlotIndex)
@@ -58,12 +58,12 @@ bool UBunkerCoverComponent::TryEnterCover(ABunkerBase* Bunker, int32 SlotIndex)
         CurrentBunker = Bunker;
         CurrentSlotIndex = SlotIndex;
 
-        const FCoverSlot& Slot = Bunker->GetSlot(SlotIndex);
-        Stance = Slot.AllowedStances.Num() ? Slot.AllowedStances[0] : ECoverStance::Crouch;
+        Stance = Bunker->GetSlot(SlotIndex).GetDefaultStance();
         Exposure = EExposureState::Hidden;
         Peek = EPeekDirection::None;
 
         SnapOwnerToSlot();
+        UpdateSlotOccupancy();
         
         OnRep_Bunker();
         OnRep_Slot();
@@ -73,6 +73,7 @@ bool UBunkerCoverComponent::TryEnterCover(ABunkerBase* Bunker, int32 SlotIndex)
     }
     else
     {
+        ++NumServerRpcs;
         Server_TryEnterCover(Bunker, SlotIndex);
         return true;
     }
@@ -86,25 +87,26 @@ void UBunkerCoverComponent::ExitCover()
         CurrentSlotIndex = INDEX_NONE;
         Exposure = EExposureState::Hidden;
         Peek = EPeekDirection::None;
+        UpdateSlotOccupancy();
         OnRep_Bunker(); OnRep_Slot(); OnRep_StanceExposure(); OnRep_Peek();
     }
     else
     {
+        ++NumServerRpcs;
         Server_ExitCover();
     }
 }
 
 bool UBunkerCoverComponent::RequestSlotMoveRelative(int32 Delta)
 {
-    DEBUG(5.0f, FColor::Black, TEXT("(1) UBunkerCoverComponent::RequestSlotMoveRelative()"));
+    BUNKER_LOG(LogBunkerCover, Verbose, TEXT("%s RequestSlotMoveRelative(%d)"), *GetNameSafe(GetOwner()), Delta);
     // return if not in cover
     if (!IsInCover() || Delta == 0) return false;
 
     // Server
     if (GetOwner()->HasAuthority())
     {
-        const int32 SlotNum = CurrentBunker->GetNumSlots();
-        int32 NewSlotIndex = FMath::Clamp(CurrentSlotIndex + Delta, 0, SlotNum - 1);
+        const int32 NewSlotIndex = CurrentBunker->GetAdjacentSlot(CurrentSlotIndex, Delta);
 
         // Transition possible
         if (NewSlotIndex != CurrentSlotIndex)
@@ -115,11 +117,11 @@ bool UBunkerCoverComponent::RequestSlotMoveRelative(int32 Delta)
 
             if (!IsStanceAllowedAtSlot(Stance, CurrentSlotIndex))
             {
-                const FCoverSlot& Slot = CurrentBunker->GetSlot(CurrentSlotIndex);
-                Stance = Slot.AllowedStances.Num() ? Slot.AllowedStances[0] : ECoverStance::Crouch;
+                Stance = CurrentBunker->GetSlot(CurrentSlotIndex).GetDefaultStance();
             }
 
             SnapOwnerToSlot();
+            UpdateSlotOccupancy();
 
             // server
             OnRep_Slot();
@@ -130,17 +132,10 @@ bool UBunkerCoverComponent::RequestSlotMoveRelative(int32 Delta)
         }
         
         // === No transition available — check for peeking instead ===
-        const FCoverSlot& Slot = CurrentBunker->GetSlot(CurrentSlotIndex);
-        EPeekDirection DesiredPeek = (Delta > 0) ? EPeekDirection::Right : EPeekDirection::Left;
-        bool bIsSnakeSlot = Slot.AllowedStances.Num() == 1 && Slot.AllowedStances[0] == ECoverStance::Prone;
-
-        // Prevent inward peeking (only allow peeking outward if we're on an end slot)
-        const bool bIsEndSlot =
-            (CurrentSlotIndex == 0 && Delta < 0) || (CurrentSlotIndex == SlotNum - 1 && Delta > 0);
-
-        // Peek if at end OR if snake-style slot
-        bool bAllowPeek = bIsEndSlot || bIsSnakeSlot;
-        if (bAllowPeek && IsPeekAllowedAtSlot(DesiredPeek, CurrentSlotIndex))
+        // GetAdjacentSlot didn't move us, so we're on this cover's end slot in that direction (per placed bunker on
+        // generated fields): peeking is outward, never inward.
+        const EPeekDirection DesiredPeek = (Delta > 0) ? EPeekDirection::Right : EPeekDirection::Left;
+        if (IsPeekAllowedAtSlot(DesiredPeek, CurrentSlotIndex))
         {
             SetPeek(DesiredPeek, true);
             return true;
@@ -150,6 +145,7 @@ bool UBunkerCoverComponent::RequestSlotMoveRelative(int32 Delta)
     {
         if (Peek == EPeekDirection::None)
         {
+            ++NumServerRpcs;
             Server_RequestSlotMoveRelative(Delta);
         }
         return true;
@@ -171,6 +167,7 @@ bool UBunkerCoverComponent::SetStance(ECoverStance NewStance)
     }
     else
     {
+        ++NumServerRpcs;
         Server_SetStance(NewStance);
         return true;
     }
@@ -181,7 +178,7 @@ bool UBunkerCoverComponent::SetPeek(EPeekDirection Direction, bool bEnable)
     if (!IsInCover()) return false;
     if (!IsPeekAllowedAtSlot(Direction, CurrentSlotIndex)) return false;
 
-    DEBUG(5.0f, FColor::Blue, TEXT("UBunkerCoverComponent::SetPeek: %s"), *StaticEnum<EPeekDirection>()->GetNameStringByValue(static_cast<int64>(Direction)));
+    BUNKER_LOG(LogBunkerCover, Verbose, TEXT("%s SetPeek %s %s"), *GetNameSafe(GetOwner()), *UEnum::GetValueAsString(Direction), bEnable ? TEXT("on") : TEXT("off"));
 
     if (GetOwner()->HasAuthority())
     {
@@ -194,6 +191,7 @@ bool UBunkerCoverComponent::SetPeek(EPeekDirection Direction, bool bEnable)
     }
     else
     {
+        ++NumServerRpcs;
         Server_SetPeek(Direction, bEnable);
         return true;
     }
@@ -212,6 +210,7 @@ bool UBunkerCoverComponent::SetExposureState(EExposureState NewExposure)
     }
     else
     {
+        ++NumServerRpcs;
         Server_SetExposure(NewExposure);
         return true;
     }
@@ -219,7 +218,8 @@ bool UBunkerCoverComponent::SetExposureState(EExposureState NewExposure)
 
 void UBunkerCoverComponent::SnapOwnerToSlot()
 {
-    DEBUG(5.0f, FColor::Yellow, TEXT("(2) Snapping owner to Slot: [%i]"), CurrentSlotIndex);
+    BUNKER_SCOPE_CYCLE_COUNTER(STAT_Bunker_SnapOwnerToSlot);
+    BUNKER_LOG(LogBunkerCover, Verbose, TEXT("%s snapping to slot %d"), *GetNameSafe(GetOwner()), CurrentSlotIndex);
     
     if (!OwnerCharacter.IsValid() || !CurrentBunker) return;
     const FTransform WT = CurrentBunker->GetSlotWorldTransform(CurrentSlotIndex);
@@ -229,95 +229,48 @@ void UBunkerCoverComponent::SnapOwnerToSlot()
 
     OwnerCharacter->SetActorLocation(WT.GetLocation());
     OwnerCharacter->SetActorRotation(NewRot);
-    
-    // TODO: notify anim system via tags / montage
+
+    // Animation polls cover state itself (UBunkerCoverAnimInstance), nothing to push here
+}
+
+void UBunkerCoverComponent::UpdateSlotOccupancy()
+{
+    if (UBunkerSlotSubsystem* SlotStore = GetWorld()->GetSubsystem<UBunkerSlotSubsystem>())
+    {
+        SlotStore->SetOccupant(GetOwner(), CurrentBunker, CurrentSlotIndex);
+    }
 }
 
 void UBunkerCoverComponent::OnRep_Bunker() { }
 void UBunkerCoverComponent::OnRep_Slot()
 {
+    BUNKER_SCOPE_CYCLE_COUNTER(STAT_Bunker_OnRepSlot);
     OnSlotChanged.Broadcast(CurrentSlotIndex);
 
-    DEBUG(5.0f, FColor::Magenta, TEXT("Broadcasting -> OnSlotChanged: [%i]"), CurrentSlotIndex);
+    BUNKER_LOG(LogBunkerCover, VeryVerbose, TEXT("%s OnRep_Slot %d"), *GetNameSafe(GetOwner()), CurrentSlotIndex);
 }
 void UBunkerCoverComponent::OnRep_StanceExposure()
 {
+    BUNKER_SCOPE_CYCLE_COUNTER(STAT_Bunker_OnRepStanceExposure);
     OnStanceChanged.Broadcast(Stance, Exposure);
 
-    const FString StanceName   = StaticEnum<ECoverStance>()
-        ? StaticEnum<ECoverStance>()->GetDisplayNameTextByValue(static_cast<int64>(Stance)).ToString()
-        : TEXT("Invalid");
-    const FString ExposureName = StaticEnum<EExposureState>()
-        ? StaticEnum<EExposureState>()->GetDisplayNameTextByValue(static_cast<int64>(Exposure)).ToString()
-        : TEXT("Invalid");
-
-    DEBUG(5.0f, FColor::Cyan, TEXT("[Cover] %s Stance=%s Exposure=%s"),
-        *GetNameSafe(GetOwner()), *StanceName, *ExposureName);
+    // Enum names are only built if the message passes the category filter
+    BUNKER_LOG(LogBunkerCover, VeryVerbose, TEXT("%s OnRep_StanceExposure Stance=%s Exposure=%s"),
+        *GetNameSafe(GetOwner()), *UEnum::GetValueAsString(Stance), *UEnum::GetValueAsString(Exposure));
 }
 void UBunkerCoverComponent::OnRep_Peek()
 {
-   OnPeekChanged.Broadcast(Peek, Peek != EPeekDirection::None);
-
-    const FCoverSlot& Slot = CurrentBunker->GetSlot(CurrentSlotIndex);
-    FVector LocalOffset = FVector::ZeroVector; // slot-local (X fwd, Y right, Z up)
-
-    switch (Peek)
-    {
-    case EPeekDirection::Left:  LocalOffset.Y = -Slot.LateralPeekOffset; break;
-    case EPeekDirection::Right: LocalOffset.Y = +Slot.LateralPeekOffset; break;
-    case EPeekDirection::Over:  LocalOffset.Z = +Slot.VerticalPeekOffset; break;
-    default: break;
-    }
+    BUNKER_SCOPE_CYCLE_COUNTER(STAT_Bunker_OnRepPeek);
+    // Camera (UBunkerCoverCameraModifier) and animation react to this; the pawn itself stays on the slot
+    OnPeekChanged.Broadcast(Peek, Peek != EPeekDirection::None);
 
-    if (OwnerCharacter.IsValid())
-    {
-        // 1) Camera: shift sideways/up using SpringArm socket offset (local to arm)
-        if (USpringArmComponent* Boom = OwnerCharacter->FindComponentByClass<USpringArmComponent>())
-        {
-            // X is forward/back along arm; Y is lateral; Z is vertical for socket offset
-            const FVector SocketOffset = (Peek == EPeekDirection::None)
-                ? FVector::ZeroVector
-                : FVector(0.f, LocalOffset.Y, LocalOffset.Z);
-
-            Boom->SocketOffset = SocketOffset;
-
-            // 2) Camera lean: small roll for visual feedback
-            const float LeanRollDeg =
-                (Peek == EPeekDirection::Left)  ? -10.f :
-                (Peek == EPeekDirection::Right) ? +10.f : 0.f;
-
-            FRotator R = Boom->GetRelativeRotation();
-            R.Roll = LeanRollDeg;
-            Boom->SetRelativeRotation(R);
-        }
-
-        const FTransform SlotWT = CurrentBunker->GetSlotWorldTransform(CurrentSlotIndex);
-        const FVector WorldOffset = SlotWT.TransformVector(LocalOffset); // rotate by slot yaw
-        const FVector Target = SlotWT.GetLocation() + WorldOffset;
-
-        // Use a swept move to respect collisions
-        OwnerCharacter->SetActorLocation(Target, /*bSweep=*/true);
-    }
-
-    // ---- Debug (designer aid): Slot -> Peek line & sphere (already good) ----
-    if (CurrentBunker)
-    {
-        const FTransform SlotWT = CurrentBunker->GetSlotWorldTransform(CurrentSlotIndex);
-        const FVector PeekPointWS = SlotWT.TransformPosition(LocalOffset);
-        const FVector SlotWS      = SlotWT.GetLocation();
-
-        DrawDebugLine(GetWorld(), SlotWS, PeekPointWS, FColor::Red, false, 5.f, 0, 2.f);
-        DrawDebugSphere(GetWorld(), PeekPointWS, 5.f, 12, FColor::Green, false, 5.f);
-    }
-
-    DEBUG(5.0f, FColor::Emerald, TEXT("OnRep_Peek --><-- Peek=%s OffsetLocal=%s"),
-        *StaticEnum<EPeekDirection>()->GetNameStringByValue((int64)Peek),
-        *LocalOffset.ToString());}
+    BUNKER_LOG(LogBunkerCover, VeryVerbose, TEXT("%s OnRep_Peek Peek=%s"), *GetNameSafe(GetOwner()), *UEnum::GetValueAsString(Peek));
+}
 
 // === RPC impls ===
-void UBunkerCoverComponent::Server_TryEnterCover_Implementation(ABunkerBase* Bunker, int32 SlotIndex){ TryEnterCover(Bunker, SlotIndex); }
-void UBunkerCoverComponent::Server_ExitCover_Implementation(){ ExitCover(); }
-void UBunkerCoverComponent::Server_RequestSlotMoveRelative_Implementation(int32 Delta){ RequestSlotMoveRelative(Delta); }
-void UBunkerCoverComponent::Server_SetStance_Implementation(ECoverStance NewStance){ SetStance(NewStance); }
-void UBunkerCoverComponent::Server_SetPeek_Implementation(EPeekDirection Direction, bool bEnable){ SetPeek(Direction, bEnable); }
-void UBunkerCoverComponent::Server_SetExposure_Implementation(EExposureState NewExposure){ SetExposureState(NewExposure); }
+void UBunkerCoverComponent::Server_TryEnterCover_Implementation(ABunkerBase* Bunker, int32 SlotIndex){ ++NumServerRpcs; TryEnterCover(Bunker, SlotIndex); }
+void UBunkerCoverComponent::Server_ExitCover_Implementation(){ ++NumServerRpcs; ExitCover(); }
+void UBunkerCoverComponent::Server_RequestSlotMoveRelative_Implementation(int32 Delta){ ++NumServerRpcs; RequestSlotMoveRelative(Delta); }
+void UBunkerCoverComponent::Server_SetStance_Implementation(ECoverStance NewStance){ ++NumServerRpcs; SetStance(NewStance); }
+void UBunkerCoverComponent::Server_SetPeek_Implementation(EPeekDirection Direction, bool bEnable){ ++NumServerRpcs; SetPeek(Direction, bEnable); }
+void UBunkerCoverComponent::Server_SetExposure_Implementation(EExposureState NewExposure){ ++NumServerRpcs; SetExposureState(NewExposure); }
@@ -60,6 +60,9 @@ public:
     UFUNCTION(BlueprintPure, Category="Cover")
     EPeekDirection GetPeek() const { return Peek; }
 
+    /** Cover RPCs sent to the server (owning client) or executed (server) by this component, for net benchmarks */
+    uint32 GetNumServerRpcs() const { return NumServerRpcs; }
+
     // Convenience wrappers (so existing code in DoMove can call TraverseLeft/Right)
     UFUNCTION(BlueprintCallable, Category="Cover")
     void TraverseLeft()  { RequestSlotMoveRelative(-1); }
@@ -107,8 +110,13 @@ protected:
 private:
     TWeakObjectPtr<ACharacter> OwnerCharacter;
 
+    uint32 NumServerRpcs = 0;
+
     void SnapOwnerToSlot();
 
+    /** Server: mirrors CurrentBunker/CurrentSlotIndex into the world slot store */
+    void UpdateSlotOccupancy();
+
     bool IsStanceAllowedAtSlot(ECoverStance InStance, int32 SlotIndex) const;
     bool IsPeekAllowedAtSlot(EPeekDirection InPeek, int32 SlotIndex) const;
 };
@@ -0,0 +1,201 @@
+// Components/MarkerFireComponent.cpp
+#include "Components/MarkerFireComponent.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
+#include "Subsystems/PaintballSubsystem.h"
+
+namespace MarkerFire
+{
+    /** Shot ages travel as 0.1 ms ticks */
+    constexpr double AgeUnitsPerSecond = 10000.0;
+
+    /** Muzzle sits this far in front of the eyes so balls don't start inside the pawn */
+    constexpr float MuzzleForwardOffset = 50.f;
+}
+
+UMarkerFireComponent::UMarkerFireComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false; // only ticks while shots are pending
+    PrimaryComponentTick.TickGroup = TG_PrePhysics;
+    SetIsReplicatedByDefault(true);
+
+    for (double& T : RecentPulls) { T = -DBL_MAX; }
+}
+
+void UMarkerFireComponent::PullTrigger()
+{
+    const double Now = FPlatformTime::Seconds();
+    bTriggerHeld = true;
+
+    RecentPulls[RecentPullHead] = Now;
+    RecentPullHead = (RecentPullHead + 1) % RecentPulls.Num();
+
+    if (FireMode == EMarkerFireMode::Ramping && CountRecentPulls(Now) >= RampStartPulls)
+    {
+        RampUntil = Now + RampSustainTime;
+    }
+
+    // The pull itself always fires, no earlier than the rate-of-fire cap allows
+    if (PendingShotTimes.Num() == 0 || PendingShotTimes.Last() <= Now)
+    {
+        QueueShot(FMath::Max(Now, NextShotTime));
+    }
+
+    SetComponentTickEnabled(true);
+}
+
+void UMarkerFireComponent::ReleaseTrigger()
+{
+    bTriggerHeld = false;
+}
+
+bool UMarkerFireComponent::IsRamping() const
+{
+    return FireMode == EMarkerFireMode::Ramping && FPlatformTime::Seconds() < RampUntil;
+}
+
+void UMarkerFireComponent::QueueShot(double ShotTime)
+{
+    PendingShotTimes.Add(ShotTime);
+    NextShotTime = ShotTime + GetShotInterval();
+}
+
+int32 UMarkerFireComponent::CountRecentPulls(double Now) const
+{
+    int32 Count = 0;
+    for (const double T : RecentPulls)
+    {
+        if (Now - T <= RampPullWindow) ++Count;
+    }
+    return Count;
+}
+
+bool UMarkerFireComponent::IsAutoFiring(double Now) const
+{
+    return (FireMode == EMarkerFireMode::FullAuto && bTriggerHeld)
+        || (FireMode == EMarkerFireMode::Ramping && Now < RampUntil);
+}
+
+void UMarkerFireComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    const double Now = FPlatformTime::Seconds();
+
+    // Generate every auto shot that came due since last frame at its exact time, not the frame time
+    if (IsAutoFiring(Now))
+    {
+        const double Interval = GetShotInterval();
+        NextShotTime = FMath::Max(NextShotTime, Now - Interval * MaxShotsPerBatch);
+        while (NextShotTime <= Now && PendingShotTimes.Num() < MaxShotsPerBatch)
+        {
+            QueueShot(NextShotTime);
+        }
+    }
+
+    FlushDueShots(Now);
+
+    if (PendingShotTimes.Num() == 0 && !IsAutoFiring(Now))
+    {
+        SetComponentTickEnabled(false);
+    }
+}
+
+void UMarkerFireComponent::FlushDueShots(double Now)
+{
+    int32 NumDue = 0;
+    while (NumDue < PendingShotTimes.Num() && PendingShotTimes[NumDue] <= Now) { ++NumDue; }
+    if (NumDue == 0) return;
+
+    BatchAges.Reset();
+    for (int32 i = 0; i < NumDue; ++i)
+    {
+        const double Age = (Now - PendingShotTimes[i]) * MarkerFire::AgeUnitsPerSecond;
+        BatchAges.Add(static_cast<uint16>(FMath::Clamp(Age, 0.0, static_cast<double>(MAX_uint16))));
+    }
+    PendingShotTimes.RemoveAt(0, NumDue, EAllowShrinking::No);
+
+    FVector Origin, Direction;
+    if (!GetMuzzle(Origin, Direction)) return;
+
+    if (GetOwner()->HasAuthority())
+    {
+        FireShots(Origin, Direction, BatchAges, GetMaxShotAge());
+    }
+    else
+    {
+        Server_FireBatch(Origin, Direction, BatchAges);
+    }
+}
+
+void UMarkerFireComponent::FireShots(const FVector& Origin, const FVector& Direction, TConstArrayView<uint16> ShotAges, float MaxAge)
+{
+    UPaintballSubsystem* Paintballs = GetWorld()->GetSubsystem<UPaintballSubsystem>();
+    if (!Paintballs) return;
+
+    const FVector Velocity = Direction * MuzzleSpeed;
+    const int32 NumShots = FMath::Min(ShotAges.Num(), MaxShotsPerBatch);
+    for (int32 i = 0; i < NumShots; ++i)
+    {
+        // Older shots get simulated further so the spacing between balls matches the trigger cadence
+        const float Age = FMath::Min(static_cast<float>(ShotAges[i] / MarkerFire::AgeUnitsPerSecond), MaxAge);
+        Paintballs->FireBall(Origin, Velocity, GetOwner(), Age);
+    }
+}
+
+bool UMarkerFireComponent::GetMuzzle(FVector& OutOrigin, FVector& OutDirection) const
+{
+    const APawn* Pawn = Cast<APawn>(GetOwner());
+    if (!Pawn) return false;
+
+    FRotator EyeRot;
+    Pawn->GetActorEyesViewPoint(OutOrigin, EyeRot);
+    OutDirection = EyeRot.Vector();
+    OutOrigin += OutDirection * MarkerFire::MuzzleForwardOffset;
+    return true;
+}
+
+float UMarkerFireComponent::GetMaxShotAge() const
+{
+    float Ping = 0.f;
+    if (const APawn* Pawn = Cast<APawn>(GetOwner()))
+    {
+        if (const APlayerState* PlayerState = Pawn->GetPlayerState())
+        {
+            Ping = PlayerState->GetPingInMilliseconds() * 0.001f;
+        }
+    }
+    return GetShotInterval() * MaxShotsPerBatch + Ping;
+}
+
+int32 UMarkerFireComponent::ConsumeServerShotCredit(int32 NumShots)
+{
+    const double Now = FPlatformTime::Seconds();
+
+    // A batch can legitimately carry a hitch's worth of shots, so the bucket holds one full batch
+    const double Elapsed = ServerCreditTime > 0.0 ? Now - ServerCreditTime : DBL_MAX;
+    ServerShotCredit = FMath::Min(ServerShotCredit + Elapsed / GetShotInterval(), static_cast<double>(MaxShotsPerBatch));
+    ServerCreditTime = Now;
+
+    const int32 Allowed = FMath::Min(NumShots, FMath::FloorToInt32(ServerShotCredit));
+    ServerShotCredit -= Allowed;
+    return Allowed;
+}
+
+// === RPC impls ===
+void UMarkerFireComponent::Server_FireBatch_Implementation(FVector_NetQuantize Origin, FVector_NetQuantizeNormal Direction, const TArray<uint16>& ShotAges)
+{
+    // Don't trust the client's muzzle: a shot can only leave from (about) where the server has the pawn
+    FVector ServerOrigin, ServerDirection;
+    if (!GetMuzzle(ServerOrigin, ServerDirection)) return;
+
+    const FVector FireOrigin = FVector::DistSquared(Origin, ServerOrigin) <= FMath::Square(MaxOriginError) ? FVector(Origin) : ServerOrigin;
+
+    // Shots beyond RateOfFire over time are dropped, however the client packs them into batches
+    const int32 NumAllowed = ConsumeServerShotCredit(ShotAges.Num());
+    if (NumAllowed == 0) return;
+
+    // Ages are clamped too, so a client can't pre-advance balls downrange or past cover
+    FireShots(FireOrigin, Direction, MakeArrayView(ShotAges).Left(NumAllowed), GetMaxShotAge());
+}
@@ -0,0 +1,111 @@
+// Components/MarkerFireComponent.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Containers/StaticArray.h"
+#include "Engine/NetSerialization.h"
+#include "MarkerFireComponent.generated.h"
+
+UENUM(BlueprintType)
+enum class EMarkerFireMode : uint8
+{
+    Semi     UMETA(DisplayName="Semi"),      // one ball per pull, capped at RateOfFire
+    Ramping  UMETA(DisplayName="Ramping"),   // semi until the pull rate ramps it to RateOfFire
+    FullAuto UMETA(DisplayName="Full Auto")  // RateOfFire while held
+};
+
+/**
+ * Schedules marker shots on a sub-frame clock instead of frame ticks.
+ * Trigger pulls are timestamped when received; ramp/auto shots are generated at exact 1/RateOfFire spacing.
+ * Every shot due in a frame is sent to the server in one RPC carrying per-shot ages, which the server uses to
+ * pre-advance each ball so cadence survives low frame rates.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class BUNKERED_API UMarkerFireComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UMarkerFireComponent();
+
+    UFUNCTION(BlueprintCallable, Category="Marker")
+    void PullTrigger();
+
+    UFUNCTION(BlueprintCallable, Category="Marker")
+    void ReleaseTrigger();
+
+    UFUNCTION(BlueprintPure, Category="Marker")
+    bool IsRamping() const;
+
+    /** Settings */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Marker")
+    EMarkerFireMode FireMode = EMarkerFireMode::Ramping;
+
+    /** Balls per second cap (semi) / cadence (ramp, auto) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Marker", meta=(ClampMin="1.0", ClampMax="30.0", Units="Hz"))
+    float RateOfFire = 15.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Marker", meta=(ClampMin="0.0", Units="cm/s"))
+    float MuzzleSpeed = 9000.f;
+
+    /** Pulls needed within RampPullWindow before the marker ramps */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Marker|Ramping", meta=(ClampMin="1", ClampMax="8"))
+    int32 RampStartPulls = 3;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Marker|Ramping", meta=(ClampMin="0.0", Units="s"))
+    float RampPullWindow = 1.f;
+
+    /** How long a ramp keeps firing after the last pull */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Marker|Ramping", meta=(ClampMin="0.0", Units="s"))
+    float RampSustainTime = 1.f;
+
+    /** Upper bound on shots generated in one frame (protects against hitches) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Marker", meta=(ClampMin="1"))
+    int32 MaxShotsPerBatch = 32;
+
+    /** Server: client-sent muzzle origins further than this from the server's muzzle are snapped to it */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Marker|Server", meta=(ClampMin="0.0", Units="cm"))
+    float MaxOriginError = 100.f;
+
+protected:
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+    /** Ages are in 0.1 ms units, measured from when the batch was sent */
+    UFUNCTION(Server, Reliable) void Server_FireBatch(FVector_NetQuantize Origin, FVector_NetQuantizeNormal Direction, const TArray<uint16>& ShotAges);
+
+private:
+    /** Shot times on the FPlatformTime clock, ascending; may hold one not-yet-due semi shot */
+    TArray<double> PendingShotTimes;
+
+    /** Reused RPC payload */
+    TArray<uint16> BatchAges;
+
+    /** Ring of recent pull times for ramp detection */
+    TStaticArray<double, 8> RecentPulls;
+    int32 RecentPullHead = 0;
+
+    double NextShotTime = 0.0;
+    double RampUntil = 0.0;
+    bool bTriggerHeld = false;
+
+    /** Server: shots the owner may still fire (token bucket refilled at RateOfFire, capped at MaxShotsPerBatch) */
+    double ServerShotCredit = 0.0;
+    double ServerCreditTime = 0.0;
+
+    float GetShotInterval() const { return 1.f / FMath::Max(RateOfFire, 1.f); }
+    void QueueShot(double ShotTime);
+    int32 CountRecentPulls(double Now) const;
+    bool IsAutoFiring(double Now) const;
+
+    void FlushDueShots(double Now);
+    void FireShots(const FVector& Origin, const FVector& Direction, TConstArrayView<uint16> ShotAges, float MaxAge);
+
+    /** Oldest a shot can legitimately be when it reaches the server: one full batch, plus the owner's ping */
+    float GetMaxShotAge() const;
+
+    /** Server: refills the shot credit and spends up to NumShots of it; returns how many shots may fire */
+    int32 ConsumeServerShotCredit(int32 NumShots);
+
+    bool GetMuzzle(FVector& OutOrigin, FVector& OutDirection) const;
+};
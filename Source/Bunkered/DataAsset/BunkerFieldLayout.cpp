@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "DataAsset/BunkerFieldLayout.h"
+
+void UBunkerFieldLayout::GetPlacements(TArray<FBunkerFieldPlacement>& OutPlacements) const
+{
+	OutPlacements.Reserve(OutPlacements.Num() + Entries.Num() * (Symmetry == EBunkerFieldSymmetry::None ? 1 : 2));
+
+	for (const FBunkerFieldEntry& Entry : Entries)
+	{
+		if (!Entry.Type)
+		{
+			continue;
+		}
+
+		OutPlacements.Add({ Entry.Type, FTransform(FRotator(0.f, Entry.Yaw, 0.f), FVector(Entry.Position, 0.f)) });
+
+		// centre line bunkers are shared by both halves
+		if (Symmetry == EBunkerFieldSymmetry::None || FMath::Abs(Entry.Position.X) <= CenterLineTolerance)
+		{
+			continue;
+		}
+
+		// mirror reflects across X = 0 (facing flips about the Y axis), rotate turns the whole half around the centre
+		const bool bMirror = Symmetry == EBunkerFieldSymmetry::Mirror;
+		const FVector2D OtherPosition = bMirror ? FVector2D(-Entry.Position.X, Entry.Position.Y) : -Entry.Position;
+		const float OtherYaw = bMirror ? 180.f - Entry.Yaw : Entry.Yaw + 180.f;
+
+		OutPlacements.Add({ Entry.Type, FTransform(FRotator(0.f, OtherYaw, 0.f), FVector(OtherPosition, 0.f)) });
+	}
+}
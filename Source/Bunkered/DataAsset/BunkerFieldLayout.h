@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "BunkerFieldLayout.generated.h"
+
+class UBunkerMetaData;
+
+/** How one half of a layout is completed into a full field */
+UENUM(BlueprintType)
+enum class EBunkerFieldSymmetry : uint8
+{
+	/** Entries are the whole field */
+	None   UMETA(DisplayName="None"),
+
+	/** Entries are one half; the other half is mirrored across the centre line (X = 0) */
+	Mirror UMETA(DisplayName="Mirror"),
+
+	/** Entries are one half; the other half is rotated 180 degrees around the field centre */
+	Rotate UMETA(DisplayName="Rotate 180")
+};
+
+/** A single bunker on the field */
+USTRUCT(BlueprintType)
+struct FBunkerFieldEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Field")
+	TObjectPtr<UBunkerMetaData> Type;
+
+	/** Field position, X down the field from the centre line, Y across it */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Field", meta=(Units="cm"))
+	FVector2D Position = FVector2D::ZeroVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Field", meta=(Units="deg"))
+	float Yaw = 0.f;
+};
+
+/** Resolved placement of one bunker, relative to the field origin */
+struct FBunkerFieldPlacement
+{
+	const UBunkerMetaData* Type = nullptr;
+	FTransform Transform;
+};
+
+/**
+ * Paintball field layout: bunker types with 2D positions, optionally authored as one half and completed by symmetry
+ * the way tournament layouts are published. Spawned by ABunkerFieldGenerator.
+ */
+UCLASS()
+class BUNKERED_API UBunkerFieldLayout : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Field")
+	TArray<FBunkerFieldEntry> Entries;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Field")
+	EBunkerFieldSymmetry Symmetry = EBunkerFieldSymmetry::Mirror;
+
+	/** Entries this close to the centre line are not duplicated by symmetry */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Field", meta=(ClampMin="0.0", Units="cm"))
+	float CenterLineTolerance = 10.f;
+
+	/** Appends every bunker of the full field (symmetry applied) to OutPlacements. Entries without a type are skipped. */
+	void GetPlacements(TArray<FBunkerFieldPlacement>& OutPlacements) const;
+};
@@ -3,3 +3,9 @@
 
 #include "DataAsset/BunkerMetaData.h"
 
+const FPrimaryAssetType UBunkerMetaData::PrimaryAssetType(TEXT("BunkerType"));
+
+FPrimaryAssetId UBunkerMetaData::GetPrimaryAssetId() const
+{
+	return FPrimaryAssetId(PrimaryAssetType, GetFName());
+}
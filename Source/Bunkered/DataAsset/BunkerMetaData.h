@@ -4,18 +4,79 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
+#include "Types/CoverTypes.h"
 #include "BunkerMetaData.generated.h"
 
+class UStaticMesh;
+
+/** Skin material of an inflatable (or hard) bunker. Drives splat/bounce FX lookups. */
+UENUM(BlueprintType)
+enum class EBunkerMaterial : uint8
+{
+	Nylon UMETA(DisplayName="Nylon"),
+	PVC   UMETA(DisplayName="PVC"),
+	Foam  UMETA(DisplayName="Foam"),
+	Wood  UMETA(DisplayName="Wood")
+};
+
+/** Per-bunker surface properties used when resolving paintball impacts */
+USTRUCT(BlueprintType)
+struct FBunkerSurfaceProperties
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Surface")
+	EBunkerMaterial Material = EBunkerMaterial::Nylon;
+
+	/** Inflation pressure. Softer bunkers (below 1 psi) soak up more of the impact, so balls bounce more often. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Surface", meta=(ClampMin="0.1", UIMin="0.1", UIMax="3.0", Units="psi"))
+	float InflationPSI = 1.0f;
+
+	/** Impact speed along the surface normal at or above which a ball breaks (at nominal 1 psi inflation). */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Surface|Break", meta=(ClampMin="0.0", Units="cm/s"))
+	float BreakSpeed = 4000.f;
+
+	/** Impacts shallower than this angle (measured from the surface plane) always bounce. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Surface|Break", meta=(ClampMin="0.0", ClampMax="90.0", Units="deg"))
+	float MinBreakAngle = 25.f;
+
+	/** Fraction of normal velocity kept when a ball bounces. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Surface|Bounce", meta=(ClampMin="0.0", ClampMax="1.0"))
+	float Restitution = 0.35f;
+
+	/** Fraction of tangential velocity kept when a ball bounces. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Surface|Bounce", meta=(ClampMin="0.0", ClampMax="1.0"))
+	float TangentialRetention = 0.8f;
+};
+
 /**
- * 
+ * Shared description of a bunker type (dorito, snake, can...), the flyweight every instance of that shape points at.
+ * Hit resolution never reads this directly; UPaintballSubsystem flattens it into a lookup table once per type.
  */
 UCLASS()
-class BUNKERED_API UBunkerMetaData : public UDataAsset
+class BUNKERED_API UBunkerMetaData : public UPrimaryDataAsset
 {
 	GENERATED_BODY()
-	
+
 public:
 
+	/** Asset manager type for bunker archetypes */
+	static const FPrimaryAssetType PrimaryAssetType;
+
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+	/** Surface response to paintball impacts */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Surface")
+	FBunkerSurfaceProperties Surface;
+
+	/** Visual and collision mesh, in the "Game" bundle. Loaded asynchronously with the map by UBunkerArchetypeSubsystem. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Archetype", meta=(AssetBundles="Game"))
+	TSoftObjectPtr<UStaticMesh> Mesh;
+
+	/** Cover slots shared by every bunker of this type, anchors relative to the bunker's origin (component references are ignored) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Archetype")
+	TArray<FCoverSlot> SlotTemplate;
+
 	// Role Tags
 
 	// kneel/stand
@@ -43,6 +43,9 @@ public:
 	
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Pawn|Input")
 	void Pawn_ChangeBunkerStance(bool bCrouching);
+
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category="Pawn|Input")
+	void Pawn_Trigger(bool bPressed);
 	
 };
 
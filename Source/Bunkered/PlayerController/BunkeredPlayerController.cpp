@@ -1,5 +1,7 @@
 // BunkeredPlayerController.cpp
 #include "BunkeredPlayerController.h"
+#include "Camera/BunkerCoverCameraModifier.h"
+#include "Camera/PlayerCameraManager.h"
 #include "Engine/LocalPlayer.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
@@ -11,11 +13,17 @@
 ABunkeredPlayerController::ABunkeredPlayerController()
 {
     bShowMouseCursor = false;
+    CoverCameraModifierClass = UBunkerCoverCameraModifier::StaticClass();
 }
 
 void ABunkeredPlayerController::BeginPlay()
 {
     Super::BeginPlay();
+
+    if (IsLocalController() && PlayerCameraManager && CoverCameraModifierClass)
+    {
+        PlayerCameraManager->AddNewCameraModifier(CoverCameraModifierClass);
+    }
 }
 
 void ABunkeredPlayerController::SetupInputComponent()
@@ -38,6 +46,13 @@ void ABunkeredPlayerController::SetupInputComponent()
         if (LookAction) EIC->BindAction(LookAction, ETriggerEvent::Triggered, this, &ABunkeredPlayerController::OnLook);
         if (EnterSlotOnBunkerAction) EIC->BindAction(EnterSlotOnBunkerAction,    ETriggerEvent::Started, this, &ABunkeredPlayerController::OnEnterSlotOnBunker);
         if (ChangeStanceAction) EIC->BindAction(ChangeStanceAction, ETriggerEvent::Started, this, &ABunkeredPlayerController::OnStanceChange);
+
+        // Pull/release only; shot cadence is scheduled by the pawn's marker, not by input frames
+        if (FireAction)
+        {
+            EIC->BindAction(FireAction, ETriggerEvent::Started,   this, &ABunkeredPlayerController::OnTriggerPressed);
+            EIC->BindAction(FireAction, ETriggerEvent::Completed, this, &ABunkeredPlayerController::OnTriggerReleased);
+        }
     }
 }
 
@@ -69,7 +84,7 @@ void ABunkeredPlayerController::OnEnterSlotOnBunker()
             Adv->UpdateSuggestion();
             if (Adv->AcceptSuggestion())
             {
-                DEBUG(3.0f, FColor::Cyan, TEXT("Moving to suggested bunker slot"));
+                BUNKER_LOG(LogBunkerInput, Log, TEXT("Moving to suggested bunker slot"));
                 return;
             }
         }
@@ -86,3 +101,19 @@ void ABunkeredPlayerController::OnStanceChange()
         IBunkerCoverInterface::Execute_Pawn_ChangeBunkerStance(P, true);
     }
 }
+
+void ABunkeredPlayerController::OnTriggerPressed()
+{
+    if (UObject* P = GetPawnObject())
+    {
+        IBunkerCoverInterface::Execute_Pawn_Trigger(P, true);
+    }
+}
+
+void ABunkeredPlayerController::OnTriggerReleased()
+{
+    if (UObject* P = GetPawnObject())
+    {
+        IBunkerCoverInterface::Execute_Pawn_Trigger(P, false);
+    }
+}
@@ -10,6 +10,7 @@ class UInputMappingContext;
 class UEnhancedInputComponent;
 class UEnhancedInputLocalPlayerSubsystem;
 class UInputAction;
+class UBunkerCoverCameraModifier;
 
 /**
  * Centralizes input. Forwards to the possessed pawn via BunkerCoverInterface.
@@ -41,6 +42,13 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category="Input") UInputAction* EnterSlotOnBunkerAction    = nullptr;
     UPROPERTY(EditDefaultsOnly, Category="Input") UInputAction* ChangeStanceAction = nullptr;
 
+    // Marker actions
+    UPROPERTY(EditDefaultsOnly, Category="Input") UInputAction* FireAction = nullptr;
+
+    /** Peek camera added to the camera manager for local players */
+    UPROPERTY(EditDefaultsOnly, Category="Camera")
+    TSubclassOf<UBunkerCoverCameraModifier> CoverCameraModifierClass;
+
 private:
     // Helpers to dispatch to the interface
     void OnMove(const FInputActionValue& Value);
@@ -49,5 +57,8 @@ private:
     void OnEnterSlotOnBunker();
     void OnStanceChange();
 
+    void OnTriggerPressed();
+    void OnTriggerReleased();
+
     UObject* GetPawnObject() const { return GetPawn(); }
 };
@@ -0,0 +1,46 @@
+// Subsystems/AISignificanceSubsystem.cpp
+#include "Subsystems/AISignificanceSubsystem.h"
+#include "Components/AISignificanceComponent.h"
+#include "SignificanceManager.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Utility/BunkerProfiling.h"
+
+DECLARE_CYCLE_STAT(TEXT("Significance update"), STAT_AILOD_Update, STATGROUP_AILOD);
+
+void UAISignificanceSubsystem::Tick(float DeltaTime)
+{
+    CSV_SCOPED_TIMING_STAT(Bunker, Significance);
+    SCOPE_CYCLE_COUNTER(STAT_AILOD_Update);
+
+    USignificanceManager* SigMan = USignificanceManager::Get(GetWorld());
+    if (!SigMan) return;
+
+    // Distance and behind-view tiers are measured from what each player actually sees: the camera's POV
+    Viewpoints.Reset();
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PC = It->Get();
+        if (!PC || !PC->GetPawnOrSpectator()) continue;
+
+        FVector Location;
+        FRotator Rotation;
+        PC->GetPlayerViewPoint(Location, Rotation);
+        Viewpoints.Emplace(Rotation, Location);
+    }
+
+    // No viewers (e.g. server between matches): keep the last tiers rather than letting everything go dormant
+    if (Viewpoints.Num() == 0) return;
+
+    SigMan->Update(Viewpoints);
+}
+
+TStatId UAISignificanceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UAISignificanceSubsystem, STATGROUP_Tickables);
+}
+
+bool UAISignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
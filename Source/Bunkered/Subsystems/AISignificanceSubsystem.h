@@ -0,0 +1,28 @@
+// Subsystems/AISignificanceSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AISignificanceSubsystem.generated.h"
+
+/**
+ * Drives the significance manager once per frame from every player's camera viewpoint (not the pawn: the
+ * side-scrolling camera sits well away from it).
+ * UAISignificanceComponent does the per-AI scoring and tier application.
+ */
+UCLASS()
+class BUNKERED_API UAISignificanceSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    /** Reused viewpoint buffer */
+    TArray<FTransform> Viewpoints;
+};
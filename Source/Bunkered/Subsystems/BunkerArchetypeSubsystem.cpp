@@ -0,0 +1,99 @@
+// Subsystems/BunkerArchetypeSubsystem.cpp
+#include "Subsystems/BunkerArchetypeSubsystem.h"
+#include "Bunkers/BunkerBase.h"
+#include "Bunkers/BunkerFieldGenerator.h"
+#include "DataAsset/BunkerFieldLayout.h"
+#include "DataAsset/BunkerMetaData.h"
+#include "Engine/AssetManager.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Utility/BunkerProfiling.h"
+#include "Utility/LoggingMacros.h"
+
+namespace BunkerArchetypes
+{
+    /** Asset bundle holding an archetype's mesh (see UBunkerMetaData::Mesh) */
+    const FName GameBundle(TEXT("Game"));
+}
+
+void UBunkerArchetypeSubsystem::PostInitialize()
+{
+    Super::PostInitialize();
+    LLM_SCOPE_BYTAG(Bunker_Slots);
+
+    // Archetypes referenced by placed bunkers and field layouts
+    TArray<FPrimaryAssetId> Ids;
+    for (TActorIterator<ABunkerBase> It(GetWorld()); It; ++It)
+    {
+        if (const UBunkerMetaData* Type = It->GetMetaData())
+        {
+            Ids.AddUnique(Type->GetPrimaryAssetId());
+        }
+        if (const ABunkerFieldGenerator* Field = Cast<ABunkerFieldGenerator>(*It))
+        {
+            if (const UBunkerFieldLayout* Layout = Field->GetLayout())
+            {
+                for (const FBunkerFieldEntry& Entry : Layout->Entries)
+                {
+                    if (Entry.Type) Ids.AddUnique(Entry.Type->GetPrimaryAssetId());
+                }
+            }
+        }
+    }
+    if (Ids.Num() == 0) return;
+
+    // The completion delegate may fire inside this call when everything is already resident
+    bLoading = true;
+    PreloadHandle = UAssetManager::Get().LoadPrimaryAssets(Ids, { BunkerArchetypes::GameBundle },
+        FStreamableDelegate::CreateUObject(this, &UBunkerArchetypeSubsystem::OnPreloadComplete));
+    if (!PreloadHandle.IsValid() || PreloadHandle->HasLoadCompleted())
+    {
+        OnPreloadComplete();
+    }
+
+    BUNKER_LOG(LogBunkerCover, Log, TEXT("Preloading %d bunker archetype(s)"), Ids.Num());
+}
+
+void UBunkerArchetypeSubsystem::OnPreloadComplete()
+{
+    if (!bLoading) return;
+    bLoading = false;
+
+    // Swap out first: a callback may register another
+    TArray<FSimpleDelegate> Callbacks = MoveTemp(LoadedCallbacks);
+    for (FSimpleDelegate& Callback : Callbacks)
+    {
+        Callback.ExecuteIfBound();
+    }
+}
+
+void UBunkerArchetypeSubsystem::CallWhenLoaded(FSimpleDelegate Callback)
+{
+    if (bLoading)
+    {
+        LoadedCallbacks.Add(MoveTemp(Callback));
+    }
+    else
+    {
+        Callback.ExecuteIfBound();
+    }
+}
+
+void UBunkerArchetypeSubsystem::Deinitialize()
+{
+    bLoading = false;
+    LoadedCallbacks.Empty();
+
+    if (PreloadHandle.IsValid())
+    {
+        PreloadHandle->ReleaseHandle();
+        PreloadHandle.Reset();
+    }
+
+    Super::Deinitialize();
+}
+
+bool UBunkerArchetypeSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,41 @@
+// Subsystems/BunkerArchetypeSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BunkerArchetypeSubsystem.generated.h"
+
+struct FStreamableHandle;
+
+/**
+ * Preloads the bunker archetypes (UBunkerMetaData, asset manager type "BunkerType") used by the level, with their
+ * "Game" bundle. The load starts while the map loads and stays asynchronous; bunkers whose mesh isn't in yet
+ * apply it from CallWhenLoaded instead of blocking.
+ */
+UCLASS()
+class BUNKERED_API UBunkerArchetypeSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void PostInitialize() override;
+    virtual void Deinitialize() override;
+
+    /** True while the level's archetype preload is still streaming */
+    bool IsLoading() const { return bLoading; }
+
+    /** Runs Callback once the preload completes, or right away if nothing is loading */
+    void CallWhenLoaded(FSimpleDelegate Callback);
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    /** Keeps the preloaded bundles referenced for the world's lifetime */
+    TSharedPtr<FStreamableHandle> PreloadHandle;
+
+    bool bLoading = false;
+    TArray<FSimpleDelegate> LoadedCallbacks;
+
+    void OnPreloadComplete();
+};
@@ -0,0 +1,343 @@
+// Subsystems/BunkerNetBenchSubsystem.cpp
+#include "Subsystems/BunkerNetBenchSubsystem.h"
+#include "Subsystems/BunkerSlotSubsystem.h"
+#include "Components/BunkerCoverComponent.h"
+#include "Interface/BunkerCoverInterface.h"
+#include "Engine/Channel.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogBunkerNetBench, Log, All);
+
+namespace BunkerNetBench
+{
+    constexpr float DefaultDuration = 120.f;
+
+    const TCHAR* ServerHeader = TEXT("Time,Connection,Player,InBitsPerSec,OutBitsPerSec,ReliableOut,ReliablePct,CoverRpcs\n");
+    const TCHAR* ClientHeader = TEXT("Time,Action,Rpcs,UpBytes,DownBytes,UpBytesOverIdle,DownBytesOverIdle,ReliableMax\n");
+    const TCHAR* SummaryHeader = TEXT("Action,Count,AvgRpcs,AvgUpBytesOverIdle,AvgDownBytesOverIdle,ReliableMax\n");
+
+    const TCHAR* ActionNames[] = { TEXT("Enter"), TEXT("TraverseRight"), TEXT("TraverseLeft"), TEXT("PeekStart"), TEXT("PeekEnd"), TEXT("Stand"), TEXT("Crouch"), TEXT("Exit") };
+
+    /** Deepest unacked reliable queue across the connection's open channels */
+    int32 ReliableOccupancy(const UNetConnection& Connection)
+    {
+        int32 Max = 0;
+        for (const UChannel* Channel : Connection.OpenChannels)
+        {
+            if (Channel) Max = FMath::Max(Max, Channel->NumOutRec);
+        }
+        return Max;
+    }
+
+    uint32 CoverRpcs(const APawn* Pawn)
+    {
+        const UBunkerCoverComponent* Cover = Pawn ? Pawn->FindComponentByClass<UBunkerCoverComponent>() : nullptr;
+        return Cover ? Cover->GetNumServerRpcs() : 0;
+    }
+}
+
+bool UBunkerNetBenchSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    return Super::ShouldCreateSubsystem(Outer) && FParse::Param(FCommandLine::Get(), TEXT("BunkerNetBench"));
+}
+
+bool UBunkerNetBenchSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UBunkerNetBenchSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UBunkerNetBenchSubsystem, STATGROUP_Tickables);
+}
+
+void UBunkerNetBenchSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    const ENetMode NetMode = InWorld.GetNetMode();
+    if (NetMode == NM_Standalone)
+    {
+        UE_LOG(LogBunkerNetBench, Warning, TEXT("-BunkerNetBench needs a server or a connected client; standalone world ignored"));
+        return;
+    }
+    bServer = NetMode != NM_Client;
+
+    if (!FParse::Value(FCommandLine::Get(), TEXT("NetBenchDuration="), Duration))
+    {
+        Duration = BunkerNetBench::DefaultDuration;
+    }
+    FParse::Value(FCommandLine::Get(), TEXT("NetBenchIdle="), IdleDuration);
+    FParse::Value(FCommandLine::Get(), TEXT("NetBenchInterval="), ActionInterval);
+    ActionInterval = FMath::Max(ActionInterval, 0.1f);
+
+    // Clients share a machine in the usual setup, so keep their reports apart
+    const FString Role = bServer ? TEXT("Server") : FString::Printf(TEXT("Client%u"), FPlatformProcess::GetCurrentProcessId());
+    const FString Timestamp = FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"));
+    const FString Folder = FPaths::ProfilingDir() / TEXT("BunkerNet");
+    IFileManager::Get().MakeDirectory(*Folder, true);
+    ReportPath = Folder / FString::Printf(TEXT("%s_%s_%s.csv"), *InWorld.GetMapName(), *Role, *Timestamp);
+    Report = bServer ? BunkerNetBench::ServerHeader : BunkerNetBench::ClientHeader;
+
+    UE_LOG(LogBunkerNetBench, Log, TEXT("Net bench started as %s: %.0fs, report %s"), *Role, Duration, *ReportPath);
+    bRunning = true;
+}
+
+void UBunkerNetBenchSubsystem::Tick(float DeltaTime)
+{
+    if (!bRunning) return;
+
+    Elapsed += DeltaTime;
+
+    if (bServer)
+    {
+        TickServer(DeltaTime);
+    }
+    else
+    {
+        UNetDriver* Net = GetWorld()->GetNetDriver();
+        UNetConnection* Connection = Net ? Net->ServerConnection.Get() : nullptr;
+        APlayerController* PC = GetWorld()->GetFirstPlayerController();
+        APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+        if (Connection && Pawn)
+        {
+            TickClient(DeltaTime, *Connection, *Pawn);
+        }
+    }
+
+    if (Elapsed >= Duration)
+    {
+        Finish(!FParse::Param(FCommandLine::Get(), TEXT("NetBenchNoExit")));
+    }
+}
+
+// === Server ===
+
+void UBunkerNetBenchSubsystem::TickServer(float DeltaTime)
+{
+    ParkNewPawns();
+
+    WindowTime += DeltaTime;
+    if (WindowTime >= 1.f)
+    {
+        WriteServerRows();
+        WindowTime = 0.f;
+    }
+}
+
+void UBunkerNetBenchSubsystem::ParkNewPawns()
+{
+    const UBunkerSlotSubsystem* SlotStore = GetWorld()->GetSubsystem<UBunkerSlotSubsystem>();
+    if (!SlotStore || SlotStore->GetNumSlots() == 0) return;
+
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PC = It->Get();
+        APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+        if (!Pawn || PC->IsLocalController() || ParkedPawns.Contains(Pawn)) continue;
+
+        // Next free slot, so every client can enter cover on its first scripted action
+        const int32 NumSlots = SlotStore->GetNumSlots();
+        for (int32 n = 0; n < NumSlots; ++n)
+        {
+            const int32 SlotId = (NextParkingSlot + n) % NumSlots;
+            if (!SlotStore->IsValidSlot(SlotId) || SlotStore->GetOccupant(SlotId)) continue;
+
+            const FVector Location = SlotStore->GetLocation(SlotId) + FVector(0.f, 0.f, Pawn->GetDefaultHalfHeight());
+            Pawn->TeleportTo(Location, SlotStore->GetForward(SlotId).Rotation());
+            NextParkingSlot = SlotId + 1;
+            break;
+        }
+        ParkedPawns.Add(Pawn);
+    }
+}
+
+void UBunkerNetBenchSubsystem::WriteServerRows()
+{
+    const UNetDriver* Net = GetWorld()->GetNetDriver();
+    if (!Net) return;
+
+    for (int32 i = 0; i < Net->ClientConnections.Num(); ++i)
+    {
+        const UNetConnection* Connection = Net->ClientConnections[i];
+        if (!Connection) continue;
+
+        const APlayerController* PC = Connection->PlayerController;
+        const APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+
+        uint32 Rpcs = 0;
+        if (Pawn)
+        {
+            const uint32 Total = BunkerNetBench::CoverRpcs(Pawn);
+            uint32& Last = LastRpcsByPawn.FindOrAdd(Pawn);
+            Rpcs = Total - Last;
+            Last = Total;
+        }
+
+        const int32 Reliable = BunkerNetBench::ReliableOccupancy(*Connection);
+        Report += FString::Printf(TEXT("%.1f,%d,%s,%d,%d,%d,%.1f,%u\n"),
+            Elapsed, i, *GetNameSafe(PC),
+            Connection->InBytesPerSecond * 8, Connection->OutBytesPerSecond * 8,
+            Reliable, 100.f * Reliable / RELIABLE_BUFFER, Rpcs);
+    }
+}
+
+// === Client ===
+
+void UBunkerNetBenchSubsystem::TickClient(float DeltaTime, UNetConnection& Connection, APawn& Pawn)
+{
+    WindowMaxReliable = FMath::Max(WindowMaxReliable, BunkerNetBench::ReliableOccupancy(Connection));
+
+    if (Phase == EPhase::WaitingForPawn)
+    {
+        // Pawn just arrived (and may still be parked by the server); start the idle baseline from here
+        Phase = EPhase::Idle;
+        BeginWindow(Connection, Pawn);
+        return;
+    }
+
+    if (Phase == EPhase::Idle)
+    {
+        const float IdleTime = Elapsed - WindowStartTime;
+        if (IdleTime < IdleDuration) return;
+
+        const double IdleSeconds = FMath::Max(IdleTime, UE_SMALL_NUMBER);
+        IdleUpBytesPerSec = (static_cast<int64>(Connection.OutTotalBytes) - WindowStartOut) / IdleSeconds;
+        IdleDownBytesPerSec = (static_cast<int64>(Connection.InTotalBytes) - WindowStartIn) / IdleSeconds;
+        UE_LOG(LogBunkerNetBench, Log, TEXT("Idle baseline: %.0f B/s up, %.0f B/s down"), IdleUpBytesPerSec, IdleDownBytesPerSec);
+
+        Phase = EPhase::Scripted;
+        ActionTimer = ActionInterval;
+    }
+
+    ActionTimer += DeltaTime;
+    if (ActionTimer < ActionInterval) return;
+    ActionTimer = 0.f;
+
+    // Each action owns the window up to the next one, so late replication of its result is still counted
+    if (PendingAction != EAction::Count)
+    {
+        CloseWindow(Connection, Pawn);
+    }
+    BeginWindow(Connection, Pawn);
+
+    PendingAction = static_cast<EAction>(NextAction);
+    NextAction = (NextAction + 1) % static_cast<int32>(EAction::Count);
+    IssueAction(Pawn, PendingAction);
+}
+
+void UBunkerNetBenchSubsystem::BeginWindow(const UNetConnection& Connection, const APawn& Pawn)
+{
+    WindowStartOut = Connection.OutTotalBytes;
+    WindowStartIn = Connection.InTotalBytes;
+    WindowStartRpcs = BunkerNetBench::CoverRpcs(&Pawn);
+    WindowMaxReliable = 0;
+    WindowStartTime = Elapsed;
+}
+
+void UBunkerNetBenchSubsystem::CloseWindow(const UNetConnection& Connection, const APawn& Pawn)
+{
+    const float WindowDuration = Elapsed - WindowStartTime;
+    const int64 Up = static_cast<int64>(Connection.OutTotalBytes) - WindowStartOut;
+    const int64 Down = static_cast<int64>(Connection.InTotalBytes) - WindowStartIn;
+    const double UpOverIdle = Up - IdleUpBytesPerSec * WindowDuration;
+    const double DownOverIdle = Down - IdleDownBytesPerSec * WindowDuration;
+    const uint32 Rpcs = BunkerNetBench::CoverRpcs(&Pawn) - WindowStartRpcs;
+
+    FActionStats& S = Stats[static_cast<int32>(PendingAction)];
+    ++S.Count;
+    S.Rpcs += Rpcs;
+    S.UpBytes += UpOverIdle;
+    S.DownBytes += DownOverIdle;
+    S.MaxReliable = FMath::Max(S.MaxReliable, WindowMaxReliable);
+
+    Report += FString::Printf(TEXT("%.2f,%s,%u,%lld,%lld,%.0f,%.0f,%d\n"),
+        WindowStartTime, BunkerNetBench::ActionNames[static_cast<int32>(PendingAction)], Rpcs, Up, Down, UpOverIdle, DownOverIdle, WindowMaxReliable);
+}
+
+void UBunkerNetBenchSubsystem::IssueAction(APawn& Pawn, EAction Action)
+{
+    const UBunkerCoverComponent* Cover = Pawn.FindComponentByClass<UBunkerCoverComponent>();
+    if (!Cover || !Pawn.GetClass()->ImplementsInterface(UBunkerCoverInterface::StaticClass())) return;
+
+    // Same entry points the player controller uses for input
+    switch (Action)
+    {
+    case EAction::Enter:
+        // EnterSlotOnBunker toggles, so only press it out of cover
+        if (!Cover->IsInCover()) IBunkerCoverInterface::Execute_EnterSlotOnBunker(&Pawn);
+        break;
+    case EAction::TraverseRight: IBunkerCoverInterface::Execute_SlotTransition(&Pawn, +1); break;
+    case EAction::TraverseLeft: IBunkerCoverInterface::Execute_SlotTransition(&Pawn, -1); break;
+    case EAction::PeekStart: IBunkerCoverInterface::Execute_SlotPeek(&Pawn, EPeekDirection::Left, true); break;
+    case EAction::PeekEnd: IBunkerCoverInterface::Execute_SlotPeek(&Pawn, EPeekDirection::Left, false); break;
+    case EAction::Stand: IBunkerCoverInterface::Execute_SetSlotStance(&Pawn, ECoverStance::Stand); break;
+    case EAction::Crouch: IBunkerCoverInterface::Execute_SetSlotStance(&Pawn, ECoverStance::Crouch); break;
+    case EAction::Exit:
+        if (Cover->IsInCover()) IBunkerCoverInterface::Execute_EnterSlotOnBunker(&Pawn);
+        break;
+    default: break;
+    }
+}
+
+void UBunkerNetBenchSubsystem::Finish(bool bRequestExit)
+{
+    if (!bRunning) return;
+    bRunning = false;
+
+    if (!bServer)
+    {
+        const UNetDriver* Net = GetWorld() ? GetWorld()->GetNetDriver() : nullptr;
+        const UNetConnection* Connection = Net ? Net->ServerConnection.Get() : nullptr;
+        const APlayerController* PC = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr;
+        if (Connection && PC && PC->GetPawn() && PendingAction != EAction::Count)
+        {
+            CloseWindow(*Connection, *PC->GetPawn());
+        }
+
+        FString Summary = BunkerNetBench::SummaryHeader;
+        for (int32 i = 0; i < static_cast<int32>(EAction::Count); ++i)
+        {
+            const FActionStats& S = Stats[i];
+            const int32 N = FMath::Max(S.Count, 1);
+            Summary += FString::Printf(TEXT("%s,%d,%.2f,%.0f,%.0f,%d\n"),
+                BunkerNetBench::ActionNames[i], S.Count, static_cast<double>(S.Rpcs) / N, S.UpBytes / N, S.DownBytes / N, S.MaxReliable);
+            UE_LOG(LogBunkerNetBench, Log, TEXT("%-14s x%-4d rpcs %.2f  up %.0f B  down %.0f B  reliable max %d"),
+                BunkerNetBench::ActionNames[i], S.Count, static_cast<double>(S.Rpcs) / N, S.UpBytes / N, S.DownBytes / N, S.MaxReliable);
+        }
+        FFileHelper::SaveStringToFile(Summary, *(FPaths::GetBaseFilename(ReportPath, false) + TEXT("_Summary.csv")));
+    }
+
+    if (FFileHelper::SaveStringToFile(Report, *ReportPath))
+    {
+        UE_LOG(LogBunkerNetBench, Log, TEXT("Net bench finished after %.0fs, report written to %s"), Elapsed, *ReportPath);
+    }
+    else
+    {
+        UE_LOG(LogBunkerNetBench, Error, TEXT("Net bench finished but %s could not be written"), *ReportPath);
+    }
+
+    if (bRequestExit)
+    {
+        FPlatformMisc::RequestExit(false, TEXT("BunkerNetBench"));
+    }
+}
+
+void UBunkerNetBenchSubsystem::Deinitialize()
+{
+    // Map change, disconnect or early shutdown: keep whatever was collected
+    Finish(false);
+    ParkedPawns.Empty();
+    LastRpcsByPawn.Empty();
+
+    Super::Deinitialize();
+}
@@ -0,0 +1,94 @@
+// Subsystems/BunkerNetBenchSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "BunkerNetBenchSubsystem.generated.h"
+
+class APawn;
+class UNetConnection;
+
+/**
+ * Headless network benchmark for cover actions. Only created when the command line carries -BunkerNetBench:
+ *
+ *   BunkeredServer Dev_TestWorld -BunkerNetBench -log
+ *   Bunkered 127.0.0.1 -BunkerNetBench -nullrhi -nosound -PktLag=60 -PktLoss=1      (one per simulated client)
+ *
+ * Server: parks each joining player's pawn on a free bunker slot and writes one row per connection per second
+ * (bits/s in and out, reliable buffer occupancy, cover RPCs executed).
+ * Client: measures an idle baseline for -NetBenchIdle seconds (default 5), then scripts enter, traverse, peek, stance
+ * and exit through the cover interface every -NetBenchInterval seconds (default 1.5) and records, per action, the
+ * RPCs sent, bytes up/down above the idle baseline and peak reliable buffer occupancy.
+ *
+ * Both sides stop after -NetBenchDuration seconds (default 120), write Saved/Profiling/BunkerNet/ reports and exit
+ * unless -NetBenchNoExit is set. Packet simulation comes from the engine's -PktLag/-PktLoss/-PktJitter options.
+ */
+UCLASS()
+class BUNKERED_API UBunkerNetBenchSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    enum class EAction : uint8 { Enter, TraverseRight, TraverseLeft, PeekStart, PeekEnd, Stand, Crouch, Exit, Count };
+    enum class EPhase : uint8 { WaitingForPawn, Idle, Scripted };
+
+    struct FActionStats
+    {
+        int32 Count = 0;
+        uint64 Rpcs = 0;
+        double UpBytes = 0.0;
+        double DownBytes = 0.0;
+        int32 MaxReliable = 0;
+    };
+
+    bool bRunning = false;
+    bool bServer = false;
+    float Duration = 120.f;
+    float Elapsed = 0.f;
+    FString ReportPath;
+    FString Report;
+
+    // === Server ===
+    TSet<TObjectKey<APawn>> ParkedPawns;
+    int32 NextParkingSlot = 0;
+    float WindowTime = 0.f;
+    TMap<TObjectKey<APawn>, uint32> LastRpcsByPawn;
+
+    // === Client ===
+    float IdleDuration = 5.f;
+    float ActionInterval = 1.5f;
+    EPhase Phase = EPhase::WaitingForPawn;
+    float ActionTimer = 0.f;
+    int32 NextAction = 0;
+    EAction PendingAction = EAction::Count;
+    double IdleUpBytesPerSec = 0.0;
+    double IdleDownBytesPerSec = 0.0;
+    int64 WindowStartOut = 0;
+    int64 WindowStartIn = 0;
+    uint32 WindowStartRpcs = 0;
+    int32 WindowMaxReliable = 0;
+    float WindowStartTime = 0.f;
+    FActionStats Stats[static_cast<int32>(EAction::Count)];
+
+    void TickServer(float DeltaTime);
+    void ParkNewPawns();
+    void WriteServerRows();
+
+    void TickClient(float DeltaTime, UNetConnection& Connection, APawn& Pawn);
+    void BeginWindow(const UNetConnection& Connection, const APawn& Pawn);
+    void CloseWindow(const UNetConnection& Connection, const APawn& Pawn);
+    void IssueAction(APawn& Pawn, EAction Action);
+
+    void Finish(bool bRequestExit);
+};
@@ -0,0 +1,266 @@
+// Subsystems/BunkerSlotSubsystem.cpp
+#include "Subsystems/BunkerSlotSubsystem.h"
+#include "Subsystems/PlayerSnapshotSubsystem.h"
+#include "Bunkers/BunkerBase.h"
+#include "Algo/BinarySearch.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Utility/BunkerProfiling.h"
+
+namespace BunkerSlots
+{
+    static TAutoConsoleVariable<int32> CVarExposureTracesPerFrame(
+        TEXT("Bunker.Slots.ExposureTracesPerFrame"),
+        64,
+        TEXT("Line traces per frame spent refreshing cached slot exposure."));
+
+    /** Eye height used for exposure traces, matches the advisor */
+    constexpr float EyeHeight = 60.f;
+}
+
+void UBunkerSlotSubsystem::Deinitialize()
+{
+    Locations.Empty();
+    Forwards.Empty();
+    Bunkers.Empty();
+    LocalIndices.Empty();
+    Occupants.Empty();
+    StanceMasks.Empty();
+    PeekMasks.Empty();
+    Exposures.Empty();
+    ExposureTimes.Empty();
+    RangeByBunker.Empty();
+    FreeRanges.Empty();
+    SlotByOccupant.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UBunkerSlotSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UBunkerSlotSubsystem, STATGROUP_Tickables);
+}
+
+SIZE_T UBunkerSlotSubsystem::GetAllocatedSize() const
+{
+    return Locations.GetAllocatedSize() + Forwards.GetAllocatedSize() + Bunkers.GetAllocatedSize()
+        + LocalIndices.GetAllocatedSize() + Occupants.GetAllocatedSize() + StanceMasks.GetAllocatedSize()
+        + PeekMasks.GetAllocatedSize() + Exposures.GetAllocatedSize() + ExposureTimes.GetAllocatedSize()
+        + RangeByBunker.GetAllocatedSize() + FreeRanges.GetAllocatedSize() + SlotByOccupant.GetAllocatedSize();
+}
+
+bool UBunkerSlotSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UBunkerSlotSubsystem::RegisterBunker(ABunkerBase* Bunker)
+{
+    if (!Bunker) return;
+    LLM_SCOPE_BYTAG(Bunker_Slots);
+
+    const int32 NumSlots = Bunker->GetNumSlots();
+    TPair<int32, int32>* Range = RangeByBunker.Find(Bunker);
+
+    // Re-registering with a different slot count: free the old range and allocate a new one
+    if (Range && Range->Value != NumSlots)
+    {
+        UnregisterBunker(Bunker);
+        Range = nullptr;
+    }
+
+    if (!Range)
+    {
+        Range = &RangeByBunker.Add(Bunker, TPair<int32, int32>(AllocateRange(NumSlots), NumSlots));
+    }
+
+    for (int32 i = 0; i < NumSlots; ++i)
+    {
+        const int32 SlotId = Range->Key + i;
+        const FTransform WT = Bunker->GetSlotWorldTransform(i);
+        Locations[SlotId] = WT.GetLocation();
+        Forwards[SlotId] = WT.GetUnitAxis(EAxis::X);
+        Bunkers[SlotId] = Bunker;
+        LocalIndices[SlotId] = i;
+        StanceMasks[SlotId] = Bunker->GetSlot(i).StanceMask;
+        PeekMasks[SlotId] = Bunker->GetSlot(i).PeekMask;
+    }
+}
+
+void UBunkerSlotSubsystem::UnregisterBunker(ABunkerBase* Bunker)
+{
+    TPair<int32, int32> Range;
+    if (!RangeByBunker.RemoveAndCopyValue(Bunker, Range)) return;
+
+    for (int32 SlotId = Range.Key; SlotId < Range.Key + Range.Value; ++SlotId)
+    {
+        if (AActor* Occupant = Occupants[SlotId].Get())
+        {
+            SlotByOccupant.Remove(Occupant);
+        }
+        Bunkers[SlotId] = nullptr;
+        Occupants[SlotId] = nullptr;
+        Exposures[SlotId] = 0.f;
+        ExposureTimes[SlotId] = 0.f;
+    }
+
+    FreeRange(Range.Key, Range.Value);
+}
+
+int32 UBunkerSlotSubsystem::AllocateRange(int32 NumSlots)
+{
+    // First fit: bunkers of a type share a slot count, so a respawned bunker usually lands exactly in its old range
+    for (int32 i = 0; i < FreeRanges.Num(); ++i)
+    {
+        TPair<int32, int32>& Free = FreeRanges[i];
+        if (Free.Value < NumSlots) continue;
+
+        const int32 First = Free.Key;
+        Free.Key += NumSlots;
+        Free.Value -= NumSlots;
+        if (Free.Value == 0)
+        {
+            FreeRanges.RemoveAt(i);
+        }
+        return First;
+    }
+
+    const int32 First = Locations.Num();
+    Locations.AddUninitialized(NumSlots);
+    Forwards.AddUninitialized(NumSlots);
+    Bunkers.AddDefaulted(NumSlots);
+    LocalIndices.AddUninitialized(NumSlots);
+    Occupants.AddDefaulted(NumSlots);
+    StanceMasks.AddZeroed(NumSlots);
+    PeekMasks.AddZeroed(NumSlots);
+    Exposures.AddZeroed(NumSlots);
+    ExposureTimes.AddZeroed(NumSlots);
+    return First;
+}
+
+void UBunkerSlotSubsystem::FreeRange(int32 First, int32 NumSlots)
+{
+    if (NumSlots <= 0) return;
+
+    // Merge with the free ranges just before and after, if they touch
+    int32 Index = Algo::LowerBoundBy(FreeRanges, First, [](const TPair<int32, int32>& Free) { return Free.Key; });
+    if (Index < FreeRanges.Num() && FreeRanges[Index].Key == First + NumSlots)
+    {
+        NumSlots += FreeRanges[Index].Value;
+        FreeRanges.RemoveAt(Index);
+    }
+    if (Index > 0 && FreeRanges[Index - 1].Key + FreeRanges[Index - 1].Value == First)
+    {
+        --Index;
+        First = FreeRanges[Index].Key;
+        NumSlots += FreeRanges[Index].Value;
+        FreeRanges.RemoveAt(Index);
+    }
+
+    // A tombstone run at the end of the store is dropped instead of kept for reuse
+    if (First + NumSlots == Locations.Num())
+    {
+        Locations.SetNum(First, EAllowShrinking::No);
+        Forwards.SetNum(First, EAllowShrinking::No);
+        Bunkers.SetNum(First, EAllowShrinking::No);
+        LocalIndices.SetNum(First, EAllowShrinking::No);
+        Occupants.SetNum(First, EAllowShrinking::No);
+        StanceMasks.SetNum(First, EAllowShrinking::No);
+        PeekMasks.SetNum(First, EAllowShrinking::No);
+        Exposures.SetNum(First, EAllowShrinking::No);
+        ExposureTimes.SetNum(First, EAllowShrinking::No);
+        return;
+    }
+
+    FreeRanges.Insert(TPair<int32, int32>(First, NumSlots), Index);
+}
+
+int32 UBunkerSlotSubsystem::FindSlotId(const ABunkerBase* Bunker, int32 LocalIndex) const
+{
+    const TPair<int32, int32>* Range = RangeByBunker.Find(Bunker);
+    if (!Range || LocalIndex < 0 || LocalIndex >= Range->Value) return INDEX_NONE;
+    return Range->Key + LocalIndex;
+}
+
+void UBunkerSlotSubsystem::SetOccupant(AActor* Occupant, const ABunkerBase* Bunker, int32 LocalIndex)
+{
+    if (!Occupant) return;
+
+    int32 PrevSlot = INDEX_NONE;
+    if (SlotByOccupant.RemoveAndCopyValue(Occupant, PrevSlot) && Occupants.IsValidIndex(PrevSlot) && Occupants[PrevSlot] == Occupant)
+    {
+        Occupants[PrevSlot] = nullptr;
+    }
+
+    const int32 SlotId = FindSlotId(Bunker, LocalIndex);
+    if (SlotId != INDEX_NONE)
+    {
+        LLM_SCOPE_BYTAG(Bunker_Slots);
+        Occupants[SlotId] = Occupant;
+        SlotByOccupant.Add(Occupant, SlotId);
+    }
+}
+
+void UBunkerSlotSubsystem::Tick(float DeltaTime)
+{
+    CSV_SCOPED_TIMING_STAT(Bunker, SlotExposure);
+
+    const int32 NumSlots = Locations.Num();
+    if (NumSlots == 0) return;
+
+    const FPlayerSnapshot* Snapshot = UPlayerSnapshotSubsystem::GetSnapshot(this);
+    const int32 TracesPerSlot = FMath::Max(Snapshot ? Snapshot->Num() : 0, 1);
+    const int32 Budget = FMath::Max(BunkerSlots::CVarExposureTracesPerFrame.GetValueOnGameThread(), 0);
+
+    // Round-robin over the store; every slot gets refreshed once per NumSlots * players / Budget frames.
+    // At least one slot per frame, so exposure keeps refreshing when there are more players than traces.
+    const int32 SlotsThisFrame = Budget > 0 ? FMath::Clamp(Budget / TracesPerSlot, 1, NumSlots) : 0;
+    const float Now = GetWorld()->GetTimeSeconds();
+    for (int32 n = 0; n < SlotsThisFrame; ++n)
+    {
+        ExposureCursor = (ExposureCursor + 1) % NumSlots;
+        if (Bunkers[ExposureCursor].IsValid())
+        {
+            RefreshExposure(ExposureCursor, Now);
+        }
+    }
+}
+
+void UBunkerSlotSubsystem::RefreshExposure(int32 SlotId, float Now)
+{
+    const FPlayerSnapshot* Snapshot = UPlayerSnapshotSubsystem::GetSnapshot(this);
+    ExposureTimes[SlotId] = Now;
+
+    if (!Snapshot || Snapshot->Num() == 0)
+    {
+        Exposures[SlotId] = 0.f;
+        return;
+    }
+
+    const ABunkerBase* Bunker = Bunkers[SlotId].Get();
+    const AActor* Occupant = Occupants[SlotId].Get();
+    const FVector SlotLoc = Locations[SlotId];
+
+    int32 NumSeeing = 0;
+    for (const FPlayerSnapshotEntry& Player : Snapshot->Players)
+    {
+        const APawn* Pawn = Player.Pawn.Get();
+        if (!Pawn || Pawn == Occupant) continue;
+
+        FCollisionQueryParams Params(SCENE_QUERY_STAT(BunkerSlotExposure), false, Pawn);
+        Params.AddIgnoredActor(Occupant);
+
+        FHitResult HR;
+        const FVector Eye = Player.Location + FVector(0, 0, BunkerSlots::EyeHeight);
+        const bool bHit = GetWorld()->LineTraceSingleByChannel(HR, Eye, SlotLoc, VisibilityChannel, Params);
+        BUNKER_COUNTER_ADD(TracesIssued, 1);
+
+        // Same rule as the advisor: a clear line, or only the slot's own bunker in the way, is exposed
+        if (!bHit || (Bunker && Bunker->IsSlotOwnCover(LocalIndices[SlotId], HR)))
+        {
+            ++NumSeeing;
+        }
+    }
+
+    Exposures[SlotId] = static_cast<float>(NumSeeing) / Snapshot->Num();
+}
@@ -0,0 +1,96 @@
+// Subsystems/BunkerSlotSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "BunkerSlotSubsystem.generated.h"
+
+class ABunkerBase;
+
+/**
+ * Flat, world-wide store of every bunker slot, kept as parallel arrays (one entry per slot, addressed by SlotId).
+ * Bunkers register on BeginPlay; cover components report occupancy; exposure to players is refreshed a few
+ * slots per frame so queries (EQS, advisor) read cached values instead of tracing.
+ */
+UCLASS()
+class BUNKERED_API UBunkerSlotSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** Adds (or re-adds) all of a bunker's slots. Slot world transforms are cached, so call again if the bunker moves. */
+    void RegisterBunker(ABunkerBase* Bunker);
+    void UnregisterBunker(ABunkerBase* Bunker);
+
+    /** Global id of a bunker's local slot, or INDEX_NONE */
+    int32 FindSlotId(const ABunkerBase* Bunker, int32 LocalIndex) const;
+
+    /** Moves Occupant into the given slot, releasing whatever slot it held before. A null Bunker just releases. */
+    void SetOccupant(AActor* Occupant, const ABunkerBase* Bunker, int32 LocalIndex);
+
+    // === Slot reads (SlotId in [0, GetNumSlots())) ===
+    int32 GetNumSlots() const { return Locations.Num(); }
+    bool IsValidSlot(int32 SlotId) const { return Bunkers.IsValidIndex(SlotId) && Bunkers[SlotId].IsValid(); }
+    TConstArrayView<FVector> GetLocations() const { return Locations; }
+    const FVector& GetLocation(int32 SlotId) const { return Locations[SlotId]; }
+    const FVector& GetForward(int32 SlotId) const { return Forwards[SlotId]; }
+    ABunkerBase* GetBunker(int32 SlotId) const { return Bunkers[SlotId].Get(); }
+    int32 GetLocalIndex(int32 SlotId) const { return LocalIndices[SlotId]; }
+    AActor* GetOccupant(int32 SlotId) const { return Occupants[SlotId].Get(); }
+
+    /** Slot capabilities, copied from FCoverSlot on registration (ECoverStanceFlags / ECoverPeekFlags) */
+    uint8 GetStanceMask(int32 SlotId) const { return StanceMasks[SlotId]; }
+    uint8 GetPeekMask(int32 SlotId) const { return PeekMasks[SlotId]; }
+
+    /** Fraction of players [0..1] that had line of sight to the slot at its last refresh */
+    float GetExposure(int32 SlotId) const { return Exposures[SlotId]; }
+
+    /** World time the slot's exposure was last refreshed */
+    float GetExposureTime(int32 SlotId) const { return ExposureTimes[SlotId]; }
+
+    /** Heap bytes held by the store's arrays and maps */
+    SIZE_T GetAllocatedSize() const;
+
+    ECollisionChannel VisibilityChannel = ECC_Visibility;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    // Parallel slot arrays. Unregistered bunkers leave tombstones (null bunker) rather than shifting ids;
+    // tombstoned ranges are reused by later registrations and trimmed off the end of the store.
+    TArray<FVector> Locations;
+    TArray<FVector> Forwards;
+    TArray<TWeakObjectPtr<ABunkerBase>> Bunkers;
+    TArray<int32> LocalIndices;
+    TArray<TWeakObjectPtr<AActor>> Occupants;
+    TArray<uint8> StanceMasks;
+    TArray<uint8> PeekMasks;
+    TArray<float> Exposures;
+    TArray<float> ExposureTimes;
+
+    /** First SlotId and slot count per bunker */
+    TMap<TObjectKey<ABunkerBase>, TPair<int32, int32>> RangeByBunker;
+
+    /** Tombstoned (First, Num) ranges, sorted by First and never adjacent to each other or the end of the store */
+    TArray<TPair<int32, int32>> FreeRanges;
+
+    /** Slot each occupant currently holds */
+    TMap<TObjectKey<AActor>, int32> SlotByOccupant;
+
+    /** Next slot to refresh exposure for */
+    int32 ExposureCursor = 0;
+
+    /** First SlotId of NumSlots contiguous slots, reusing a free range when one is big enough */
+    int32 AllocateRange(int32 NumSlots);
+
+    /** Returns a tombstoned range to the free list, merging neighbours and trimming the store's tail */
+    void FreeRange(int32 First, int32 NumSlots);
+
+    void RefreshExposure(int32 SlotId, float Now);
+};
@@ -0,0 +1,245 @@
+// Subsystems/BunkerSoakSubsystem.cpp
+#include "Subsystems/BunkerSoakSubsystem.h"
+#include "Subsystems/PaintballSubsystem.h"
+#include "Subsystems/StateTreeSchedulerSubsystem.h"
+#include "Characters/BunkeredCharacter.h"
+#include "Components/BunkerBotInputComponent.h"
+#include "Components/BunkerCoverComponent.h"
+#include "Interface/BunkerCoverInterface.h"
+#include "Utility/BunkerProfiling.h"
+#include "AIController.h"
+#include "EngineUtils.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/PlayerStart.h"
+#include "HAL/FileManager.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogBunkerSoak, Log, All);
+
+namespace BunkerSoak
+{
+    constexpr float DefaultDuration = 300.f;
+
+    /** Bots sharing a player start are placed on a ring this wide around it */
+    constexpr float SpawnRingRadius = 150.f;
+
+    const TCHAR* ReportHeader = TEXT("Time,Frames,FrameMsAvg,FrameMsMax,Bots,BotsInCover,BotActions,BallsInFlight,StateTrees\n");
+
+    UClass* ResolvePawnClass(const UWorld& World)
+    {
+        FString PawnPath;
+        if (FParse::Value(FCommandLine::Get(), TEXT("SoakPawn="), PawnPath))
+        {
+            if (UClass* Loaded = LoadClass<APawn>(nullptr, *PawnPath))
+            {
+                return Loaded;
+            }
+            UE_LOG(LogBunkerSoak, Warning, TEXT("SoakPawn '%s' could not be loaded"), *PawnPath);
+        }
+
+        // Prefer the map's own pawn (usually a BP with meshes and tuning) when it takes cover input
+        const AGameModeBase* GameMode = World.GetAuthGameMode();
+        UClass* DefaultPawn = GameMode ? GameMode->DefaultPawnClass.Get() : nullptr;
+        if (DefaultPawn && DefaultPawn->ImplementsInterface(UBunkerCoverInterface::StaticClass()))
+        {
+            return DefaultPawn;
+        }
+        return ABunkeredCharacter::StaticClass();
+    }
+}
+
+bool UBunkerSoakSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+    int32 NumBots = 0;
+    return Super::ShouldCreateSubsystem(Outer) && FParse::Value(FCommandLine::Get(), TEXT("BunkerSoak="), NumBots) && NumBots > 0;
+}
+
+bool UBunkerSoakSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UBunkerSoakSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UBunkerSoakSubsystem, STATGROUP_Tickables);
+}
+
+void UBunkerSoakSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Bots are server-side; a client that happens to share the command line just plays normally
+    if (InWorld.GetNetMode() == NM_Client) return;
+
+    int32 NumBots = 0;
+    int32 Seed = 0;
+    FString Label = TEXT("Soak");
+    FParse::Value(FCommandLine::Get(), TEXT("BunkerSoak="), NumBots);
+    FParse::Value(FCommandLine::Get(), TEXT("SoakSeed="), Seed);
+    FParse::Value(FCommandLine::Get(), TEXT("SoakLabel="), Label);
+    if (!FParse::Value(FCommandLine::Get(), TEXT("SoakDuration="), Duration))
+    {
+        Duration = BunkerSoak::DefaultDuration;
+    }
+
+    const FString Timestamp = FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"));
+    const FString BaseName = FString::Printf(TEXT("%s_%s_%s"), *InWorld.GetMapName(), *Label, *Timestamp);
+    const FString Folder = FPaths::ProfilingDir() / TEXT("BunkerSoak");
+    IFileManager::Get().MakeDirectory(*Folder, true);
+    ReportPath = Folder / (BaseName + TEXT(".csv"));
+    Report = BunkerSoak::ReportHeader;
+
+    SpawnBots(NumBots, Seed);
+
+#if CSV_PROFILER
+    if (FCsvProfiler* Csv = FCsvProfiler::Get(); Csv && !Csv->IsCapturing())
+    {
+        Csv->BeginCapture(-1, Folder, BaseName + TEXT("_Profile.csv"));
+    }
+#endif
+
+    UE_LOG(LogBunkerSoak, Log, TEXT("Soak started: %d bots, %.0fs, report %s"), Bots.Num(), Duration, *ReportPath);
+    UE_LOG(LogBunkerSoak, Log, TEXT("Bots are server-side and open no client connections; use the net bench for replication load"));
+    bRunning = true;
+}
+
+void UBunkerSoakSubsystem::SpawnBots(int32 Count, int32 Seed)
+{
+    UWorld* World = GetWorld();
+    UClass* PawnClass = BunkerSoak::ResolvePawnClass(*World);
+
+    TArray<const APlayerStart*> Starts;
+    for (TActorIterator<APlayerStart> It(World); It; ++It)
+    {
+        Starts.Add(*It);
+    }
+
+    FActorSpawnParameters Params;
+    Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    for (int32 i = 0; i < Count; ++i)
+    {
+        FVector Location = FVector::ZeroVector;
+        FRotator Rotation = FRotator::ZeroRotator;
+        if (Starts.Num() > 0)
+        {
+            const APlayerStart* Start = Starts[i % Starts.Num()];
+            const float Angle = 2.f * PI * (i / Starts.Num()) / FMath::Max(FMath::DivideAndRoundUp(Count, Starts.Num()), 1);
+            Location = Start->GetActorLocation() + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.f) * BunkerSoak::SpawnRingRadius;
+            Rotation = Start->GetActorRotation();
+        }
+
+        APawn* Bot = World->SpawnActor<APawn>(PawnClass, Location, Rotation, Params);
+        if (!Bot) continue;
+
+        if (!Bot->AIControllerClass) Bot->AIControllerClass = AAIController::StaticClass();
+        if (!Bot->GetController()) Bot->SpawnDefaultController();
+
+        UBunkerBotInputComponent* Input = NewObject<UBunkerBotInputComponent>(Bot, TEXT("BotInput"));
+        Input->RandomSeed = Seed != 0 ? Seed + i : 0;
+        Input->RegisterComponent();
+
+        Bots.Add(Bot);
+    }
+}
+
+void UBunkerSoakSubsystem::Tick(float DeltaTime)
+{
+    if (!bRunning) return;
+
+    const float FrameMs = static_cast<float>(FApp::GetDeltaTime() * 1000.0);
+    ++WindowFrames;
+    WindowFrameMsSum += FrameMs;
+    WindowFrameMsMax = FMath::Max(WindowFrameMsMax, FrameMs);
+
+    Elapsed += DeltaTime;
+    WindowTime += DeltaTime;
+    if (WindowTime >= 1.f)
+    {
+        WriteRow();
+    }
+
+    if (Elapsed >= Duration)
+    {
+        Finish(!FParse::Param(FCommandLine::Get(), TEXT("SoakNoExit")));
+    }
+}
+
+void UBunkerSoakSubsystem::WriteRow()
+{
+    const UWorld* World = GetWorld();
+
+    int32 NumBots = 0, InCover = 0, Actions = 0;
+    for (const TWeakObjectPtr<APawn>& Bot : Bots)
+    {
+        const APawn* Pawn = Bot.Get();
+        if (!Pawn) continue;
+
+        ++NumBots;
+        if (const UBunkerCoverComponent* Cover = Pawn->FindComponentByClass<UBunkerCoverComponent>())
+        {
+            InCover += Cover->IsInCover() ? 1 : 0;
+        }
+        if (const UBunkerBotInputComponent* Input = Pawn->FindComponentByClass<UBunkerBotInputComponent>())
+        {
+            Actions += Input->GetNumActions();
+        }
+    }
+
+    const UPaintballSubsystem* Paintballs = World->GetSubsystem<UPaintballSubsystem>();
+    const UStateTreeSchedulerSubsystem* Scheduler = World->GetSubsystem<UStateTreeSchedulerSubsystem>();
+
+    Report += FString::Printf(TEXT("%.1f,%d,%.3f,%.3f,%d,%d,%d,%d,%d\n"),
+        Elapsed, WindowFrames, WindowFrames > 0 ? WindowFrameMsSum / WindowFrames : 0.0, WindowFrameMsMax,
+        NumBots, InCover, Actions,
+        Paintballs ? Paintballs->GetNumBallsInFlight() : 0,
+        Scheduler ? Scheduler->GetNumRegistered() : 0);
+
+    WindowTime = 0.f;
+    WindowFrames = 0;
+    WindowFrameMsSum = 0.0;
+    WindowFrameMsMax = 0.f;
+}
+
+void UBunkerSoakSubsystem::Finish(bool bRequestExit)
+{
+    if (!bRunning) return;
+    bRunning = false;
+
+    if (WindowFrames > 0) WriteRow();
+
+#if CSV_PROFILER
+    if (FCsvProfiler* Csv = FCsvProfiler::Get(); Csv && Csv->IsCapturing())
+    {
+        Csv->EndCapture();
+    }
+#endif
+
+    if (FFileHelper::SaveStringToFile(Report, *ReportPath))
+    {
+        UE_LOG(LogBunkerSoak, Log, TEXT("Soak finished after %.0fs, report written to %s"), Elapsed, *ReportPath);
+    }
+    else
+    {
+        UE_LOG(LogBunkerSoak, Error, TEXT("Soak finished but %s could not be written"), *ReportPath);
+    }
+
+    if (bRequestExit)
+    {
+        FPlatformMisc::RequestExit(false, TEXT("BunkerSoak"));
+    }
+}
+
+void UBunkerSoakSubsystem::Deinitialize()
+{
+    // Map change or early shutdown: keep whatever was collected
+    Finish(false);
+    Bots.Empty();
+
+    Super::Deinitialize();
+}
@@ -0,0 +1,61 @@
+// Subsystems/BunkerSoakSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BunkerSoakSubsystem.generated.h"
+
+class APawn;
+
+/**
+ * Headless soak harness. Only created when the command line carries -BunkerSoak=<NumBots>, e.g.
+ *
+ *   BunkeredServer Dev_TestWorld -BunkerSoak=32 -SoakDuration=600 -nullrhi -log
+ *   Bunkered Dev_TestWorld?listen -BunkerSoak=32 -nullrhi -nosound
+ *
+ * Spawns bots with a UBunkerBotInputComponent at the map's player starts, runs for -SoakDuration seconds
+ * (default 300), then writes Saved/Profiling/BunkerSoak/<Map>_<Label>_<Timestamp>.csv and exits.
+ * The report has one row per second: frame time and bunker gameplay counters. A csvprofile capture runs alongside
+ * it; per-subsystem timings are in its "Bunker" category.
+ *
+ * Bots are server-side pawns that open no client connections, so the soak measures server CPU only and reports no
+ * net bandwidth or RPC figures. Measure replication load with real clients instead (see UBunkerNetBenchSubsystem).
+ *
+ * Optional: -SoakLabel=<build name>, -SoakSeed=<int> (repeatable bot inputs), -SoakPawn=<class path>, -SoakNoExit.
+ */
+UCLASS()
+class BUNKERED_API UBunkerSoakSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    bool IsRunning() const { return bRunning; }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    bool bRunning = false;
+    float Duration = 300.f;
+    float Elapsed = 0.f;
+    FString ReportPath;
+    FString Report;
+
+    TArray<TWeakObjectPtr<APawn>> Bots;
+
+    // Current one-second window
+    float WindowTime = 0.f;
+    int32 WindowFrames = 0;
+    double WindowFrameMsSum = 0.0;
+    float WindowFrameMsMax = 0.f;
+
+    void SpawnBots(int32 Count, int32 Seed);
+    void WriteRow();
+    void Finish(bool bRequestExit);
+};
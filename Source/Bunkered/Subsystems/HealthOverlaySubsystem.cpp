@@ -0,0 +1,78 @@
+// Subsystems/HealthOverlaySubsystem.cpp
+#include "Subsystems/HealthOverlaySubsystem.h"
+#include "GameFramework/Actor.h"
+#include "Utility/BunkerProfiling.h"
+
+SIZE_T UHealthOverlaySubsystem::GetAllocatedSize() const
+{
+    return Bars.GetAllocatedSize() + IndexByActor.GetAllocatedSize();
+}
+
+void UHealthOverlaySubsystem::Deinitialize()
+{
+    Bars.Empty();
+    IndexByActor.Empty();
+
+    Super::Deinitialize();
+}
+
+void UHealthOverlaySubsystem::AddBar(AActor* Actor, const FLinearColor& Color, float HeightOffset)
+{
+    if (!Actor) return;
+    LLM_SCOPE_BYTAG(Gameplay_UI);
+
+    FHealthBarEntry* Entry = Find(Actor);
+    if (!Entry)
+    {
+        IndexByActor.Add(Actor, Bars.Num());
+        Entry = &Bars.AddDefaulted_GetRef();
+        Entry->Actor = Actor;
+        Entry->Key = Actor;
+    }
+
+    Entry->Color = Color;
+    Entry->HeightOffset = HeightOffset;
+}
+
+void UHealthOverlaySubsystem::RemoveBar(AActor* Actor)
+{
+    int32 Index = INDEX_NONE;
+    if (!IndexByActor.RemoveAndCopyValue(Actor, Index)) return;
+
+    // Swap-remove, then repoint whoever moved into the hole
+    Bars.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    if (Bars.IsValidIndex(Index))
+    {
+        IndexByActor.Add(Bars[Index].Key, Index);
+    }
+}
+
+FHealthBarEntry* UHealthOverlaySubsystem::Find(const AActor* Actor)
+{
+    const int32* Index = IndexByActor.Find(Actor);
+    return Index ? &Bars[*Index] : nullptr;
+}
+
+void UHealthOverlaySubsystem::SetPercent(const AActor* Actor, float Percent)
+{
+    if (FHealthBarEntry* Entry = Find(Actor))
+    {
+        Entry->Percent = FMath::Clamp(Percent, 0.f, 1.f);
+    }
+}
+
+void UHealthOverlaySubsystem::SetVisible(const AActor* Actor, bool bVisible)
+{
+    if (FHealthBarEntry* Entry = Find(Actor))
+    {
+        Entry->bVisible = bVisible;
+    }
+}
+
+void UHealthOverlaySubsystem::SetColor(const AActor* Actor, const FLinearColor& Color)
+{
+    if (FHealthBarEntry* Entry = Find(Actor))
+    {
+        Entry->Color = Color;
+    }
+}
@@ -0,0 +1,53 @@
+// Subsystems/HealthOverlaySubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "HealthOverlaySubsystem.generated.h"
+
+/** One overhead health bar. Kept small so the HUD can walk the whole array each frame. */
+struct FHealthBarEntry
+{
+    TWeakObjectPtr<AActor> Actor;
+
+    /** Map key for this entry; stays valid after Actor goes stale */
+    TObjectKey<AActor> Key;
+
+    FLinearColor Color = FLinearColor::Red;
+    float Percent = 1.f;
+    float HeightOffset = 0.f;
+    bool bVisible = true;
+};
+
+/**
+ * Registry of overhead health bars, drawn in one pass by the HUD (see ACombatHUD) instead of a widget component
+ * per actor. Owners register on BeginPlay, push percent/visibility changes, and unregister on EndPlay.
+ */
+UCLASS()
+class BUNKERED_API UHealthOverlaySubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    /** Adds a bar above Actor, HeightOffset above its origin. Re-adding updates color and offset. */
+    void AddBar(AActor* Actor, const FLinearColor& Color, float HeightOffset);
+    void RemoveBar(AActor* Actor);
+
+    void SetPercent(const AActor* Actor, float Percent);
+    void SetVisible(const AActor* Actor, bool bVisible);
+    void SetColor(const AActor* Actor, const FLinearColor& Color);
+
+    TConstArrayView<FHealthBarEntry> GetBars() const { return Bars; }
+
+    /** Heap bytes held by the bar registry */
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    TArray<FHealthBarEntry> Bars;
+    TMap<TObjectKey<AActor>, int32> IndexByActor;
+
+    FHealthBarEntry* Find(const AActor* Actor);
+};
@@ -0,0 +1,176 @@
+// Subsystems/MeleeTraceSubsystem.cpp
+#include "Subsystems/MeleeTraceSubsystem.h"
+#include "CombatAttacker.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Utility/BunkerProfiling.h"
+
+namespace MeleeTrace
+{
+    static TAutoConsoleVariable<bool> CVarAsyncTraces(
+        TEXT("Bunker.Melee.AsyncTraces"),
+        false,
+        TEXT("Flush queued melee sweeps as async physics queries; hits are applied one frame later."));
+
+    UMeleeTraceSubsystem* Get(const AActor* Attacker)
+    {
+        const UWorld* World = Attacker ? Attacker->GetWorld() : nullptr;
+        return World ? World->GetSubsystem<UMeleeTraceSubsystem>() : nullptr;
+    }
+}
+
+void UMeleeTraceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    AsyncDelegate.BindUObject(this, &UMeleeTraceSubsystem::OnAsyncSweepDone);
+}
+
+void UMeleeTraceSubsystem::Deinitialize()
+{
+    Pending.Empty();
+    Swings.Empty();
+    InFlight.Empty();
+    AsyncDelegate.Unbind();
+
+    Super::Deinitialize();
+}
+
+TStatId UMeleeTraceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMeleeTraceSubsystem, STATGROUP_Tickables);
+}
+
+bool UMeleeTraceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UMeleeTraceSubsystem::PruneSwings()
+{
+    for (auto It = Swings.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().ResolveObjectPtr()) It.RemoveCurrent();
+    }
+}
+
+void UMeleeTraceSubsystem::BeginSwing(AActor* Attacker)
+{
+    UMeleeTraceSubsystem* Subsystem = MeleeTrace::Get(Attacker);
+    if (!Subsystem) return;
+
+    Subsystem->PruneSwings();
+
+    FSwing& Swing = Subsystem->Swings.FindOrAdd(Attacker);
+    Swing.Id = ++Subsystem->NextSwingId;
+    Swing.Hits.Reset();
+}
+
+void UMeleeTraceSubsystem::EndSwing(AActor* Attacker)
+{
+    UMeleeTraceSubsystem* Subsystem = MeleeTrace::Get(Attacker);
+    if (!Subsystem) return;
+
+    Subsystem->PruneSwings();
+
+    if (FSwing* Swing = Subsystem->Swings.Find(Attacker))
+    {
+        Swing->Id = 0;
+        Swing->Hits.Reset();
+    }
+}
+
+uint32 UMeleeTraceSubsystem::FindOrBeginSwing(AActor* Attacker)
+{
+    // A notify outside BeginSwing/EndSwing (e.g. a Blueprint-driven attack) still gets per-actor dedup
+    FSwing& Swing = Swings.FindOrAdd(Attacker);
+    if (Swing.Id == 0) Swing.Id = ++NextSwingId;
+    return Swing.Id;
+}
+
+void UMeleeTraceSubsystem::QueueSweep(AActor* Attacker, const FVector& Start, const FVector& End, float Radius, const FCollisionObjectQueryParams& ObjectParams)
+{
+    if (!Attacker) return;
+
+    FSweepRequest& Request = Pending.AddDefaulted_GetRef();
+    Request.Attacker = Attacker;
+    Request.SwingId = FindOrBeginSwing(Attacker);
+    Request.Start = Start;
+    Request.End = End;
+    Request.Radius = Radius;
+    Request.ObjectParams = ObjectParams;
+}
+
+void UMeleeTraceSubsystem::Tick(float DeltaTime)
+{
+    if (Pending.Num() == 0) return;
+
+    CSV_SCOPED_TIMING_STAT(Bunker, MeleeTraces);
+
+    UWorld* World = GetWorld();
+    const bool bAsync = MeleeTrace::CVarAsyncTraces.GetValueOnGameThread();
+
+    // Index loop: a hit reaction may queue further sweeps, which then run in this same flush
+    for (int32 i = 0; i < Pending.Num(); ++i)
+    {
+        const FSweepRequest Request = Pending[i];
+        AActor* Attacker = Request.Attacker.Get();
+        if (!Attacker) continue;
+
+        const FCollisionShape Shape = FCollisionShape::MakeSphere(Request.Radius);
+        const FCollisionQueryParams Params(SCENE_QUERY_STAT(MeleeAttackTrace), false, Attacker);
+
+        if (bAsync)
+        {
+            const uint32 Id = ++NextAsyncId;
+            InFlight.Add(Id, { Attacker, Request.SwingId });
+            World->AsyncSweepByObjectType(EAsyncTraceType::Multi, Request.Start, Request.End, FQuat::Identity,
+                Request.ObjectParams, Shape, Params, &AsyncDelegate, Id);
+        }
+        else
+        {
+            HitScratch.Reset();
+            World->SweepMultiByObjectType(HitScratch, Request.Start, Request.End, FQuat::Identity, Request.ObjectParams, Shape, Params);
+            DispatchHits(Attacker, Request.SwingId, HitScratch);
+        }
+    }
+
+    Pending.Reset();
+}
+
+void UMeleeTraceSubsystem::OnAsyncSweepDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+    FInFlightSweep Sweep;
+    if (!InFlight.RemoveAndCopyValue(Datum.UserData, Sweep)) return;
+
+    if (AActor* Attacker = Sweep.Attacker.Get())
+    {
+        DispatchHits(Attacker, Sweep.SwingId, Datum.OutHits);
+    }
+}
+
+void UMeleeTraceSubsystem::DispatchHits(AActor* Attacker, uint32 SwingId, TConstArrayView<FHitResult> Hits)
+{
+    ICombatAttacker* Receiver = Cast<ICombatAttacker>(Attacker);
+    if (!Receiver) return;
+
+    // A multi-sweep returns one hit per component, so a capsule + mesh pawn shows up twice
+    for (const FHitResult& Hit : Hits)
+    {
+        const AActor* HitActor = Hit.GetActor();
+        if (!HitActor) continue;
+
+        // Looked up per hit: the receiver may have ended this swing or started others, reallocating Swings
+        FSwing* Swing = Swings.Find(Attacker);
+        if (!Swing || Swing->Id != SwingId) break;
+
+        bool bAlreadyHit = false;
+        Swing->Hits.Add(HitActor, &bAlreadyHit);
+        if (bAlreadyHit) continue;
+
+        Receiver->HandleAttackHit(Hit);
+
+        // The receiver may have killed or destroyed the attacker
+        if (!IsValid(Attacker)) break;
+    }
+}
@@ -0,0 +1,87 @@
+// Subsystems/MeleeTraceSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CollisionQueryParams.h"
+#include "WorldCollision.h"
+#include "MeleeTraceSubsystem.generated.h"
+
+/**
+ * Collects melee attack sweeps (ICombatAttacker::DoAttackTrace) and runs them once per frame.
+ * Within one swing (BeginSwing to EndSwing) each actor is reported at most once, however many components or
+ * notifies touched it. With Bunker.Melee.AsyncTraces the flush issues async traces and hits land next frame.
+ * Hits whose swing has ended or been replaced by the time they are dispatched are dropped.
+ */
+UCLASS()
+class BUNKERED_API UMeleeTraceSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** Starts a new swing for Attacker: actors hit by its previous swing can be hit again */
+    static void BeginSwing(AActor* Attacker);
+
+    /** Ends Attacker's swing and forgets its hits (the entry is kept so the next swing allocates nothing) */
+    static void EndSwing(AActor* Attacker);
+
+    /** Queues a sphere sweep for Attacker's current swing. Attacker must implement ICombatAttacker and is always ignored. */
+    void QueueSweep(AActor* Attacker, const FVector& Start, const FVector& End, float Radius, const FCollisionObjectQueryParams& ObjectParams);
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FSweepRequest
+    {
+        TWeakObjectPtr<AActor> Attacker;
+        uint32 SwingId = 0;
+        FVector Start = FVector::ZeroVector;
+        FVector End = FVector::ZeroVector;
+        float Radius = 0.f;
+        FCollisionObjectQueryParams ObjectParams;
+    };
+
+    struct FSwing
+    {
+        uint32 Id = 0;
+        TSet<TObjectKey<AActor>> Hits;
+    };
+
+    struct FInFlightSweep
+    {
+        TWeakObjectPtr<AActor> Attacker;
+        uint32 SwingId = 0;
+    };
+
+    /** Sweeps queued this frame, flushed in Tick. Reset, not freed, so queueing allocates nothing once warm. */
+    TArray<FSweepRequest> Pending;
+
+    /** Current swing per attacker (Id 0 between swings). Kept across swings so their hit sets reuse memory. */
+    TMap<TObjectKey<AActor>, FSwing> Swings;
+    uint32 NextSwingId = 0;
+
+    /** Async sweeps still in flight, keyed by the UserData passed with the trace */
+    TMap<uint32, FInFlightSweep> InFlight;
+    uint32 NextAsyncId = 0;
+    FTraceDelegate AsyncDelegate;
+
+    // Reused between flushes so dispatching allocates nothing once warm
+    TArray<FHitResult> HitScratch;
+
+    /** Id of Attacker's current swing, starting one if it has none */
+    uint32 FindOrBeginSwing(AActor* Attacker);
+
+    /** Drops the swing entries of destroyed attackers, which never reach EndSwing */
+    void PruneSwings();
+
+    void OnAsyncSweepDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+    /** Reports each actor in Hits that swing SwingId hasn't hit yet to Attacker; stops if the swing ends */
+    void DispatchHits(AActor* Attacker, uint32 SwingId, TConstArrayView<FHitResult> Hits);
+};
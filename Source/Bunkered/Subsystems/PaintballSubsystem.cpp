@@ -0,0 +1,181 @@
+// Subsystems/PaintballSubsystem.cpp
+#include "Subsystems/PaintballSubsystem.h"
+#include "DataAsset/BunkerMetaData.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "Utility/BunkerProfiling.h"
+
+namespace PaintballSim
+{
+    /** Inflation at which BunkerMetaData break speeds are authored */
+    constexpr float NominalInflationPSI = 1.0f;
+
+    /** Nudge off the surface after a bounce so the next trace doesn't start inside it */
+    constexpr float BounceSurfaceOffset = 0.5f;
+}
+
+UPaintballSubsystem::UPaintballSubsystem()
+{
+}
+
+void UPaintballSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Index 0: anything that isn't a registered bunker (ground, pawns, props). Always breaks.
+    Surfaces.Reset();
+    Surfaces.AddDefaulted();
+
+    Balls.Reset();
+    Balls.Reserve(MaxBallsInFlight);
+}
+
+void UPaintballSubsystem::Deinitialize()
+{
+    Balls.Empty();
+    Surfaces.Empty();
+    SurfaceByType.Empty();
+    SurfaceByComponent.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UPaintballSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UPaintballSubsystem, STATGROUP_Tickables);
+}
+
+int32 UPaintballSubsystem::RegisterSurface(const UBunkerMetaData* MetaData)
+{
+    if (!MetaData) return 0;
+
+    if (const int32* Existing = SurfaceByType.Find(MetaData))
+    {
+        return *Existing;
+    }
+
+    const FBunkerSurfaceProperties& Props = MetaData->Surface;
+
+    // Softer bunkers absorb more of the hit, so it takes a harder impact to break on them
+    const float InflationScale = FMath::Clamp(PaintballSim::NominalInflationPSI / FMath::Max(Props.InflationPSI, 0.1f), 0.5f, 2.f);
+    const float BreakSpeed = Props.BreakSpeed * InflationScale;
+    const float SinMinAngle = FMath::Sin(FMath::DegreesToRadians(Props.MinBreakAngle));
+
+    FPaintballSurfaceEntry Entry;
+    Entry.BreakSpeedSq = FMath::Square(BreakSpeed);
+    Entry.SinMinBreakAngleSq = FMath::Square(SinMinAngle);
+    Entry.Restitution = Props.Restitution;
+    Entry.TangentialRetention = Props.TangentialRetention;
+    Entry.Material = static_cast<uint8>(Props.Material);
+
+    const int32 Index = Surfaces.Add(Entry);
+    SurfaceByType.Add(MetaData, Index);
+    return Index;
+}
+
+void UPaintballSubsystem::RegisterSurfaceComponent(const UPrimitiveComponent* Component, int32 SurfaceIndex)
+{
+    if (!Component || !Surfaces.IsValidIndex(SurfaceIndex)) return;
+    SurfaceByComponent.Add(Component, SurfaceIndex);
+}
+
+void UPaintballSubsystem::UnregisterSurfaceComponent(const UPrimitiveComponent* Component)
+{
+    SurfaceByComponent.Remove(Component);
+}
+
+bool UPaintballSubsystem::FireBall(const FVector& Origin, const FVector& Velocity, AActor* Instigator, float PreAdvanceSeconds)
+{
+    if (Balls.Num() >= MaxBallsInFlight) return false;
+
+    FPaintball& Ball = Balls.AddDefaulted_GetRef();
+    Ball.Location = Origin;
+    Ball.Velocity = Velocity;
+    Ball.Instigator = Instigator;
+
+    if (PreAdvanceSeconds > 0.f && !StepBall(Ball, PreAdvanceSeconds))
+    {
+        Balls.Pop(EAllowShrinking::No);
+        return false;
+    }
+    return true;
+}
+
+EPaintballHitResult UPaintballSubsystem::ResolveHit(const FPaintballSurfaceEntry& Surface, FVector& InOutVelocity, const FVector& Normal)
+{
+    // Speed into the surface (positive when approaching)
+    const float NormalSpeed = -FVector::DotProduct(InOutVelocity, Normal);
+    const float NormalSpeedSq = FMath::Square(NormalSpeed);
+
+    const bool bSteepEnough = NormalSpeedSq >= Surface.SinMinBreakAngleSq * InOutVelocity.SizeSquared();
+    if (NormalSpeed > 0.f && bSteepEnough && NormalSpeedSq >= Surface.BreakSpeedSq)
+    {
+        return EPaintballHitResult::Break;
+    }
+
+    // Reflect: keep a fraction of the tangential part, flip and damp the normal part
+    const FVector Tangential = InOutVelocity + Normal * NormalSpeed;
+    InOutVelocity = Tangential * Surface.TangentialRetention + Normal * (FMath::Max(NormalSpeed, 0.f) * Surface.Restitution);
+    return EPaintballHitResult::Bounce;
+}
+
+void UPaintballSubsystem::Tick(float DeltaTime)
+{
+    CSV_SCOPED_TIMING_STAT(Bunker, Paintballs);
+
+    // Iterate backwards so retired balls can be swap-removed without skipping any
+    for (int32 i = Balls.Num() - 1; i >= 0; --i)
+    {
+        if (!StepBall(Balls[i], DeltaTime))
+        {
+            Balls.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        }
+    }
+}
+
+bool UPaintballSubsystem::StepBall(FPaintball& Ball, float DeltaTime)
+{
+    Ball.Age += DeltaTime;
+    if (Ball.Age > MaxBallLifetime) return false;
+
+    UWorld* World = GetWorld();
+    const FVector Gravity(0.f, 0.f, World->GetGravityZ());
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(PaintballStep), false, Ball.Instigator.Get());
+
+    // Each bounce uses up part of the step; the rest is simulated from the impact point.
+    // MaxBounces bounds the loop even when a trace hits at its very start.
+    float Remaining = DeltaTime;
+    while (Remaining > UE_KINDA_SMALL_NUMBER)
+    {
+        const FVector Start = Ball.Location;
+        const FVector End = Start + Ball.Velocity * Remaining + 0.5f * Gravity * FMath::Square(Remaining);
+
+        FHitResult HR;
+        if (!World->LineTraceSingleByChannel(HR, Start, End, TraceChannel, Params))
+        {
+            Ball.Location = End;
+            Ball.Velocity += Gravity * Remaining;
+            return true;
+        }
+
+        // The trace follows the chord of the arc, so its hit fraction is a close enough time of impact
+        const float HitTime = Remaining * HR.Time;
+        Ball.Velocity += Gravity * HitTime;
+        Remaining -= HitTime;
+
+        const int32* SurfaceIdx = SurfaceByComponent.Find(HR.GetComponent());
+        const FPaintballSurfaceEntry& Surface = Surfaces[SurfaceIdx ? *SurfaceIdx : 0];
+
+        const FVector Normal = HR.ImpactNormal;
+        if (Ball.Bounces >= MaxBounces || ResolveHit(Surface, Ball.Velocity, Normal) == EPaintballHitResult::Break)
+        {
+            OnPaintballSplat.Broadcast(HR.ImpactPoint, Normal, HR.GetActor(), Ball.Instigator.Get());
+            return false;
+        }
+
+        // Bounced: velocity was reflected in place
+        ++Ball.Bounces;
+        Ball.Location = HR.ImpactPoint + Normal * PaintballSim::BounceSurfaceOffset;
+    }
+    return true;
+}
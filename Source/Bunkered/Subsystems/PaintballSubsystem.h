@@ -0,0 +1,104 @@
+// Subsystems/PaintballSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "PaintballSubsystem.generated.h"
+
+class UBunkerMetaData;
+class UPrimitiveComponent;
+
+/** Outcome of a paintball striking a surface */
+UENUM(BlueprintType)
+enum class EPaintballHitResult : uint8
+{
+    Break  UMETA(DisplayName="Break"),
+    Bounce UMETA(DisplayName="Bounce")
+};
+
+/** Flattened copy of a bunker type's surface properties. Plain data so the hit path never touches UObjects. */
+struct FPaintballSurfaceEntry
+{
+    /** Squared normal impact speed at or above which the ball breaks (inflation already applied) */
+    float BreakSpeedSq = 0.f;
+
+    /** Squared sine of the minimum break angle; shallower impacts always bounce */
+    float SinMinBreakAngleSq = 0.f;
+
+    float Restitution = 0.f;
+    float TangentialRetention = 0.f;
+    uint8 Material = 0;
+};
+
+/** A ball in flight. Lives in a fixed-capacity pool; bounces update it in place. */
+struct FPaintball
+{
+    FVector Location = FVector::ZeroVector;
+    FVector Velocity = FVector::ZeroVector;
+    float Age = 0.f;
+    uint8 Bounces = 0;
+    TWeakObjectPtr<AActor> Instigator;
+};
+
+DECLARE_MULTICAST_DELEGATE_FourParams(FOnPaintballSplat, const FVector& /*Location*/, const FVector& /*Normal*/, AActor* /*HitActor*/, AActor* /*Instigator*/);
+
+/**
+ * Simulates paintballs as plain structs and resolves break-or-bounce against bunker surfaces.
+ * Bunkers register their UBunkerMetaData once; hits look the surface up by component in a flat table.
+ */
+UCLASS()
+class BUNKERED_API UPaintballSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UPaintballSubsystem();
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /** Returns the surface table index for a bunker type, flattening it on first use. INDEX 0 is the default surface. */
+    int32 RegisterSurface(const UBunkerMetaData* MetaData);
+
+    /** Maps a collision component to a surface index so impacts on it resolve against that type */
+    void RegisterSurfaceComponent(const UPrimitiveComponent* Component, int32 SurfaceIndex);
+    void UnregisterSurfaceComponent(const UPrimitiveComponent* Component);
+
+    /**
+     * Launches a ball. PreAdvanceSeconds simulates the ball forward immediately (used to honour sub-frame fire times).
+     * Returns false if the pool is full, or if the ball already broke or expired during the pre-advance.
+     */
+    bool FireBall(const FVector& Origin, const FVector& Velocity, AActor* Instigator, float PreAdvanceSeconds = 0.f);
+
+    /** Resolves an impact. On bounce, InOutVelocity is reflected in place. */
+    static EPaintballHitResult ResolveHit(const FPaintballSurfaceEntry& Surface, FVector& InOutVelocity, const FVector& Normal);
+
+    int32 GetNumBallsInFlight() const { return Balls.Num(); }
+
+    /** Fired when a ball breaks */
+    FOnPaintballSplat OnPaintballSplat;
+
+    /** Pool capacity; FireBall fails once this many balls are in flight */
+    int32 MaxBallsInFlight = 512;
+
+    /** Balls older than this are retired without a splat */
+    float MaxBallLifetime = 3.f;
+
+    /** Balls that have bounced this many times break on their next impact */
+    uint8 MaxBounces = 3;
+
+    ECollisionChannel TraceChannel = ECC_Visibility;
+
+private:
+    TArray<FPaintballSurfaceEntry> Surfaces;
+    TMap<TObjectKey<UBunkerMetaData>, int32> SurfaceByType;
+    TMap<TObjectKey<UPrimitiveComponent>, int32> SurfaceByComponent;
+
+    TArray<FPaintball> Balls;
+
+    /** Advances one ball, carrying on after each bounce for the rest of the step; returns false when it should be retired */
+    bool StepBall(FPaintball& Ball, float DeltaTime);
+};
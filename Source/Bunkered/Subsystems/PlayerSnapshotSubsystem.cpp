@@ -0,0 +1,64 @@
+// Subsystems/PlayerSnapshotSubsystem.cpp
+#include "Subsystems/PlayerSnapshotSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "GenericTeamAgentInterface.h"
+
+int32 FPlayerSnapshot::FindClosest(const FVector& From, float& OutDistSq) const
+{
+    int32 BestIdx = INDEX_NONE;
+    float BestSq = FLT_MAX;
+
+    for (int32 i = 0; i < Players.Num(); ++i)
+    {
+        const float DistSq = FVector::DistSquared(From, Players[i].Location);
+        if (DistSq < BestSq)
+        {
+            BestSq = DistSq;
+            BestIdx = i;
+        }
+    }
+
+    if (BestIdx != INDEX_NONE)
+    {
+        OutDistSq = BestSq;
+    }
+    return BestIdx;
+}
+
+const FPlayerSnapshot& UPlayerSnapshotSubsystem::GetSnapshot()
+{
+    if (Snapshot.Frame != GFrameCounter)
+    {
+        Rebuild();
+    }
+    return Snapshot;
+}
+
+const FPlayerSnapshot* UPlayerSnapshotSubsystem::GetSnapshot(const UObject* WorldContext)
+{
+    const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    UPlayerSnapshotSubsystem* Subsystem = World ? World->GetSubsystem<UPlayerSnapshotSubsystem>() : nullptr;
+    return Subsystem ? &Subsystem->GetSnapshot() : nullptr;
+}
+
+void UPlayerSnapshotSubsystem::Rebuild()
+{
+    Snapshot.Frame = GFrameCounter;
+    Snapshot.Players.Reset();
+
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PC = It->Get();
+        APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+        if (!Pawn) continue;
+
+        FPlayerSnapshotEntry& Entry = Snapshot.Players.AddDefaulted_GetRef();
+        Entry.Pawn = Pawn;
+        Entry.Location = Pawn->GetActorLocation();
+        Entry.Velocity = Pawn->GetVelocity();
+        Entry.ViewRotation = PC->GetControlRotation();
+        Entry.TeamId = FGenericTeamId::GetTeamIdentifier(PC).GetId();
+    }
+}
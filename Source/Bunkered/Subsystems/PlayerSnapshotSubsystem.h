@@ -0,0 +1,55 @@
+// Subsystems/PlayerSnapshotSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PlayerSnapshotSubsystem.generated.h"
+
+class APawn;
+
+/** One player pawn as seen by AI this frame */
+struct FPlayerSnapshotEntry
+{
+    TWeakObjectPtr<APawn> Pawn;
+    FVector Location = FVector::ZeroVector;
+    FVector Velocity = FVector::ZeroVector;
+    FRotator ViewRotation = FRotator::ZeroRotator;
+    uint8 TeamId = 255; // FGenericTeamId::NoTeam
+};
+
+/** Immutable per-frame view of every player-controlled pawn. Readers address players by index. */
+struct FPlayerSnapshot
+{
+    uint64 Frame = 0;
+    TArray<FPlayerSnapshotEntry> Players;
+
+    int32 Num() const { return Players.Num(); }
+    bool IsValidIndex(int32 Index) const { return Players.IsValidIndex(Index); }
+    const FPlayerSnapshotEntry& operator[](int32 Index) const { return Players[Index]; }
+
+    /** Index of the player closest to From, or INDEX_NONE. OutDistSq is left untouched when none is found. */
+    int32 FindClosest(const FVector& From, float& OutDistSq) const;
+};
+
+/**
+ * Publishes player pawn location, velocity and team once per frame for AI.
+ * The snapshot is built lazily by the first reader each frame, so StateTree tasks and EQS contexts
+ * share one pass over the player controllers instead of each calling GetPlayerPawn.
+ */
+UCLASS()
+class BUNKERED_API UPlayerSnapshotSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Returns this frame's snapshot, building it if nobody has asked yet this frame */
+    const FPlayerSnapshot& GetSnapshot();
+
+    /** Convenience for callers that only have a world context */
+    static const FPlayerSnapshot* GetSnapshot(const UObject* WorldContext);
+
+private:
+    FPlayerSnapshot Snapshot;
+
+    void Rebuild();
+};
@@ -0,0 +1,249 @@
+// Subsystems/RagdollBudgetSubsystem.cpp
+#include "Subsystems/RagdollBudgetSubsystem.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "Utility/BunkerProfiling.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogRagdollBudget, Log, All);
+
+namespace RagdollBudget
+{
+    static TAutoConsoleVariable<int32> CVarMaxSimulated(
+        TEXT("Bunker.Ragdoll.MaxSimulated"),
+        8,
+        TEXT("Skeletal meshes allowed to simulate physics at once (death ragdolls and hit reactions)."));
+
+    /** Root body speed under which a ragdoll counts as still */
+    constexpr float SettleSpeed = 15.f;
+
+    /** How long a ragdoll must stay still before it's frozen */
+    constexpr float SettleTime = 0.5f;
+
+    /** Ragdolls still twitching after this long are frozen anyway */
+    constexpr float MaxSimTime = 5.f;
+
+    /** A ragdoll must have fallen this long before a newer death may evict it */
+    constexpr float MinSimTimeBeforeEvict = 0.75f;
+
+    /** Hit reactions that never get ended (no landing) are blended out after this long */
+    constexpr float MaxHitReactionTime = 2.f;
+
+    /** Slot fallback death sequences play in; the combat AnimBPs route it to the full body */
+    const FName FallbackSlot(TEXT("DefaultSlot"));
+}
+
+void URagdollBudgetSubsystem::Deinitialize()
+{
+    Simulated.Empty();
+    Frozen.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId URagdollBudgetSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(URagdollBudgetSubsystem, STATGROUP_Tickables);
+}
+
+bool URagdollBudgetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+int32 URagdollBudgetSubsystem::FindSimulated(const USkeletalMeshComponent* Mesh) const
+{
+    return Simulated.IndexOfByPredicate([Mesh](const FSimulatedRagdoll& R) { return R.Mesh.Get() == Mesh; });
+}
+
+bool URagdollBudgetSubsystem::ReserveSlot()
+{
+    const int32 Budget = FMath::Max(RagdollBudget::CVarMaxSimulated.GetValueOnGameThread(), 0);
+    if (Simulated.Num() < Budget) return true;
+
+    // Full: give the slot of the oldest ragdoll that's already on its way down to the newcomer
+    for (int32 i = 0; i < Simulated.Num(); ++i)
+    {
+        const FSimulatedRagdoll& Oldest = Simulated[i];
+        if (Oldest.bHitReaction || Oldest.SimTime < RagdollBudget::MinSimTimeBeforeEvict) continue;
+
+        if (USkeletalMeshComponent* Mesh = Oldest.Mesh.Get())
+        {
+            Freeze(Mesh);
+        }
+        Simulated.RemoveAt(i);
+        return true;
+    }
+    return false;
+}
+
+bool URagdollBudgetSubsystem::BeginRagdoll(USkeletalMeshComponent* Mesh, UAnimSequenceBase* FallbackAnimation)
+{
+    if (!Mesh) return false;
+
+    // A hit reaction in progress already holds a slot; upgrade it
+    const int32 Existing = FindSimulated(Mesh);
+    if (Existing != INDEX_NONE)
+    {
+        Simulated[Existing].bHitReaction = false;
+        Simulated[Existing].SimTime = 0.f;
+    }
+    else if (!ReserveSlot())
+    {
+        if (!PlayFallback(Mesh, FallbackAnimation))
+        {
+            UE_LOG(LogRagdollBudget, Warning, TEXT("%s: ragdoll budget full and no playable death animation, freezing its pose"), *GetNameSafe(Mesh->GetOwner()));
+            FreezePose(Mesh);
+        }
+        return false;
+    }
+    else
+    {
+        Simulated.AddDefaulted_GetRef().Mesh = Mesh;
+    }
+
+    Mesh->SetSimulatePhysics(true);
+    return true;
+}
+
+bool URagdollBudgetSubsystem::PlayFallback(USkeletalMeshComponent* Mesh, UAnimSequenceBase* FallbackAnimation)
+{
+    UAnimInstance* AnimInstance = FallbackAnimation ? Mesh->GetAnimInstance() : nullptr;
+    if (!AnimInstance) return false;
+
+    if (UAnimMontage* Montage = Cast<UAnimMontage>(FallbackAnimation))
+    {
+        return AnimInstance->Montage_Play(Montage) > 0.f;
+    }
+
+    UAnimMontage* Dynamic = AnimInstance->PlaySlotAnimationAsDynamicMontage(FallbackAnimation, RagdollBudget::FallbackSlot);
+    if (!Dynamic) return false;
+
+    // Hold the final frame instead of blending back to idle
+    Dynamic->bEnableAutoBlendOut = false;
+    return true;
+}
+
+void URagdollBudgetSubsystem::FreezePose(USkeletalMeshComponent* Mesh)
+{
+    Freeze(Mesh);
+    Frozen.Last().bPausedAnims = true;
+    Mesh->bPauseAnims = true;
+}
+
+bool URagdollBudgetSubsystem::BeginHitReaction(USkeletalMeshComponent* Mesh, float BlendWeight)
+{
+    if (!Mesh) return false;
+
+    const int32 Existing = FindSimulated(Mesh);
+    if (Existing != INDEX_NONE)
+    {
+        Simulated[Existing].SimTime = 0.f;
+    }
+    else
+    {
+        // Hit reactions never evict; they're cosmetic
+        const int32 Budget = FMath::Max(RagdollBudget::CVarMaxSimulated.GetValueOnGameThread(), 0);
+        if (Simulated.Num() >= Budget) return false;
+
+        FSimulatedRagdoll& Entry = Simulated.AddDefaulted_GetRef();
+        Entry.Mesh = Mesh;
+        Entry.bHitReaction = true;
+    }
+
+    Mesh->SetPhysicsBlendWeight(BlendWeight);
+    return true;
+}
+
+void URagdollBudgetSubsystem::EndHitReaction(USkeletalMeshComponent* Mesh)
+{
+    const int32 Index = FindSimulated(Mesh);
+    if (Index == INDEX_NONE || !Simulated[Index].bHitReaction) return;
+
+    Simulated.RemoveAt(Index);
+    Mesh->SetPhysicsBlendWeight(0.f);
+}
+
+void URagdollBudgetSubsystem::ReleaseRagdoll(USkeletalMeshComponent* Mesh)
+{
+    if (!Mesh) return;
+
+    const int32 Index = FindSimulated(Mesh);
+    if (Index != INDEX_NONE) Simulated.RemoveAt(Index);
+
+    const int32 FrozenIndex = Frozen.IndexOfByPredicate([Mesh](const FFrozenRagdoll& R) { return R.Mesh.Get() == Mesh; });
+    if (FrozenIndex != INDEX_NONE)
+    {
+        Mesh->bNoSkeletonUpdate = false;
+        if (Frozen[FrozenIndex].bPausedAnims) Mesh->bPauseAnims = false;
+        Mesh->SetComponentTickEnabled(true);
+        Mesh->SetCollisionEnabled(Frozen[FrozenIndex].Collision);
+        Frozen.RemoveAtSwap(FrozenIndex);
+    }
+}
+
+void URagdollBudgetSubsystem::Freeze(USkeletalMeshComponent* Mesh)
+{
+    FFrozenRagdoll& Entry = Frozen.AddDefaulted_GetRef();
+    Entry.Mesh = Mesh;
+    Entry.Collision = Mesh->GetCollisionEnabled();
+
+    // Stop refreshing bones first so turning physics off keeps the simulated pose instead of snapping to animation
+    Mesh->bNoSkeletonUpdate = true;
+    Mesh->SetAllBodiesSimulatePhysics(false);
+    Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Mesh->SetComponentTickEnabled(false);
+}
+
+void URagdollBudgetSubsystem::Tick(float DeltaTime)
+{
+    CSV_SCOPED_TIMING_STAT(Bunker, Ragdolls);
+
+    using namespace RagdollBudget;
+
+    Frozen.RemoveAllSwap([](const FFrozenRagdoll& R) { return !R.Mesh.IsValid(); });
+
+    for (int32 i = Simulated.Num() - 1; i >= 0; --i)
+    {
+        FSimulatedRagdoll& Entry = Simulated[i];
+        USkeletalMeshComponent* Mesh = Entry.Mesh.Get();
+
+        if (!Mesh)
+        {
+            Simulated.RemoveAt(i);
+            continue;
+        }
+
+        Entry.SimTime += DeltaTime;
+
+        // Hit reactions keep the root kinematic, so only their timeout applies
+        if (Entry.bHitReaction)
+        {
+            if (Entry.SimTime >= MaxHitReactionTime)
+            {
+                Mesh->SetPhysicsBlendWeight(0.f);
+                Simulated.RemoveAt(i);
+            }
+            continue;
+        }
+
+        // Physics was switched off behind our back (e.g. respawn)
+        if (!Mesh->IsSimulatingPhysics())
+        {
+            Simulated.RemoveAt(i);
+            continue;
+        }
+
+        const bool bStill = Mesh->GetPhysicsLinearVelocity().SizeSquared() < FMath::Square(SettleSpeed);
+        Entry.StillTime = bStill ? Entry.StillTime + DeltaTime : 0.f;
+
+        if (Entry.StillTime >= SettleTime || Entry.SimTime >= MaxSimTime)
+        {
+            Freeze(Mesh);
+            Simulated.RemoveAt(i);
+        }
+    }
+
+    CSV_CUSTOM_STAT(Bunker, SimulatedRagdolls, Simulated.Num(), ECsvCustomStatOp::Set);
+}
@@ -0,0 +1,82 @@
+// Subsystems/RagdollBudgetSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "RagdollBudgetSubsystem.generated.h"
+
+class UAnimSequenceBase;
+class USkeletalMeshComponent;
+
+/**
+ * Caps how many skeletal meshes simulate physics at once (Bunker.Ragdoll.MaxSimulated), counting death ragdolls and
+ * partial hit reactions alike. Settled death ragdolls are frozen in their last pose with physics and collision off.
+ * When the budget is full, a death evicts the oldest ragdoll that has had time to fall, or plays a canned death
+ * animation instead of simulating (or, with none, freezes the mesh in its current pose).
+ */
+UCLASS()
+class BUNKERED_API URagdollBudgetSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    /**
+     * Starts a full death ragdoll on Mesh. Returns false if over budget; FallbackAnimation is then played instead and
+     * holds its last frame. A montage plays as authored (auto blend out off); a sequence plays in the DefaultSlot.
+     * Without a playable fallback the mesh is frozen in its current pose.
+     */
+    bool BeginRagdoll(USkeletalMeshComponent* Mesh, UAnimSequenceBase* FallbackAnimation);
+
+    /** Blends Mesh partly into physics for a hit reaction. Returns false (and does nothing) if over budget. */
+    bool BeginHitReaction(USkeletalMeshComponent* Mesh, float BlendWeight);
+
+    /** Blends a hit reaction back to animation */
+    void EndHitReaction(USkeletalMeshComponent* Mesh);
+
+    /** Stops tracking Mesh and undoes any freeze. Call before reusing a dead character's mesh. */
+    void ReleaseRagdoll(USkeletalMeshComponent* Mesh);
+
+    int32 GetNumSimulated() const { return Simulated.Num(); }
+    int32 GetNumFrozen() const { return Frozen.Num(); }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FSimulatedRagdoll
+    {
+        TWeakObjectPtr<USkeletalMeshComponent> Mesh;
+        float SimTime = 0.f;
+        float StillTime = 0.f;
+        bool bHitReaction = false;
+    };
+
+    struct FFrozenRagdoll
+    {
+        TWeakObjectPtr<USkeletalMeshComponent> Mesh;
+        ECollisionEnabled::Type Collision = ECollisionEnabled::NoCollision;
+        bool bPausedAnims = false;
+    };
+
+    /** Oldest first */
+    TArray<FSimulatedRagdoll> Simulated;
+    TArray<FFrozenRagdoll> Frozen;
+
+    int32 FindSimulated(const USkeletalMeshComponent* Mesh) const;
+
+    /** Makes room for one more simulated mesh if possible */
+    bool ReserveSlot();
+
+    void Freeze(USkeletalMeshComponent* Mesh);
+
+    /** Plays FallbackAnimation on Mesh and holds its last frame; false if it couldn't be played */
+    static bool PlayFallback(USkeletalMeshComponent* Mesh, UAnimSequenceBase* FallbackAnimation);
+
+    /** Over-budget death with nothing to play: stops animation too, so the character doesn't stand idle */
+    void FreezePose(USkeletalMeshComponent* Mesh);
+};
@@ -0,0 +1,174 @@
+// Subsystems/StateTreeSchedulerSubsystem.cpp
+#include "Subsystems/StateTreeSchedulerSubsystem.h"
+#include "Components/AISignificanceComponent.h"
+#include "Components/StateTreeComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "Utility/BunkerProfiling.h"
+
+DECLARE_CYCLE_STAT(TEXT("StateTree scheduler"), STAT_AILOD_Scheduler, STATGROUP_AILOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("StateTrees ticked"), STAT_AILOD_TreesTicked, STATGROUP_AILOD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("StateTrees deferred"), STAT_AILOD_TreesDeferred, STATGROUP_AILOD);
+
+namespace StateTreeScheduler
+{
+    static TAutoConsoleVariable<float> CVarBudgetMs(
+        TEXT("Bunker.AI.StateTreeBudgetMs"),
+        2.f,
+        TEXT("Milliseconds per frame the StateTree scheduler may spend ticking AI logic."));
+
+    /** Trees ticked every frame regardless of budget, so a single slow tree can't stall everyone */
+    constexpr int32 MinTicksPerFrame = 1;
+
+    /** Upper bound on the catch-up delta handed to a tree that was deferred for a long time */
+    constexpr float MaxDeltaTime = 0.5f;
+}
+
+void UStateTreeSchedulerSubsystem::Register(UStateTreeComponent* StateTree, UAISignificanceComponent* Significance)
+{
+    if (!StateTree) return;
+
+    for (const FEntry& Entry : Entries)
+    {
+        if (Entry.StateTree == StateTree) return;
+    }
+
+    StateTree->SetComponentTickEnabled(false);
+
+    FEntry& Entry = Entries.AddDefaulted_GetRef();
+    Entry.StateTree = StateTree;
+    Entry.Significance = Significance;
+    Entry.LastTickTime = GetWorld()->GetTimeSeconds() - GetWorld()->GetDeltaSeconds();
+}
+
+void UStateTreeSchedulerSubsystem::Unregister(UStateTreeComponent* StateTree)
+{
+    for (int32 i = 0; i < Entries.Num(); ++i)
+    {
+        if (Entries[i].StateTree == StateTree)
+        {
+            // A tree's tick can unpossess or destroy pawns; the dead entry is dropped at the start of the next Tick
+            if (bTicking)
+            {
+                Entries[i].StateTree = nullptr;
+            }
+            else
+            {
+                Entries.RemoveAtSwap(i, 1, EAllowShrinking::No);
+            }
+            return;
+        }
+    }
+}
+
+void UStateTreeSchedulerSubsystem::RegisterPossessed(UStateTreeComponent* StateTree, const APawn* Pawn)
+{
+    UWorld* World = StateTree ? StateTree->GetWorld() : nullptr;
+    if (UStateTreeSchedulerSubsystem* Scheduler = World ? World->GetSubsystem<UStateTreeSchedulerSubsystem>() : nullptr)
+    {
+        Scheduler->Register(StateTree, Pawn ? Pawn->FindComponentByClass<UAISignificanceComponent>() : nullptr);
+    }
+}
+
+void UStateTreeSchedulerSubsystem::UnregisterFromWorld(UStateTreeComponent* StateTree, bool bRestoreComponentTick)
+{
+    UWorld* World = StateTree ? StateTree->GetWorld() : nullptr;
+    if (UStateTreeSchedulerSubsystem* Scheduler = World ? World->GetSubsystem<UStateTreeSchedulerSubsystem>() : nullptr)
+    {
+        Scheduler->Unregister(StateTree);
+        if (bRestoreComponentTick)
+        {
+            StateTree->SetComponentTickEnabled(true);
+        }
+    }
+}
+
+float UStateTreeSchedulerSubsystem::GetPriorityWeight(const FEntry& Entry) const
+{
+    const UAISignificanceComponent* Significance = Entry.Significance.Get();
+    if (!Significance) return 1.f;
+
+    switch (Significance->GetTier())
+    {
+    case EAISignificanceTier::High:    return 8.f;
+    case EAISignificanceTier::Medium:  return 4.f;
+    case EAISignificanceTier::Low:     return 2.f;
+    default:                           return 1.f;
+    }
+}
+
+void UStateTreeSchedulerSubsystem::Tick(float DeltaTime)
+{
+    CSV_SCOPED_TIMING_STAT(Bunker, StateTreeScheduler);
+    SCOPE_CYCLE_COUNTER(STAT_AILOD_Scheduler);
+
+    const double Now = GetWorld()->GetTimeSeconds();
+
+    // Drop dead entries first so candidate indices stay stable
+    for (int32 i = Entries.Num() - 1; i >= 0; --i)
+    {
+        if (!Entries[i].StateTree.IsValid())
+        {
+            Entries.RemoveAtSwap(i, 1, EAllowShrinking::No);
+        }
+    }
+
+    // Gather trees that are due
+    Candidates.Reset();
+    for (int32 i = 0; i < Entries.Num(); ++i)
+    {
+        UStateTreeComponent* StateTree = Entries[i].StateTree.Get();
+
+        // StartLogic and friends can turn the component's own tick back on
+        if (StateTree->IsComponentTickEnabled())
+        {
+            StateTree->SetComponentTickEnabled(false);
+        }
+
+        const float Staleness = static_cast<float>(Now - Entries[i].LastTickTime);
+        if (Staleness <= 0.f || Staleness < StateTree->GetComponentTickInterval()) continue;
+
+        Candidates.Add({ Staleness * GetPriorityWeight(Entries[i]), i });
+    }
+
+    Candidates.Sort([](const FCandidate& A, const FCandidate& B) { return A.Priority > B.Priority; });
+
+    const double BudgetSeconds = FMath::Max(StateTreeScheduler::CVarBudgetMs.GetValueOnGameThread(), 0.f) * 0.001;
+    const double StartTime = FPlatformTime::Seconds();
+
+    // Entries only grow (Register appends) or get cleared (Unregister) while ticking, so indices stay valid
+    TGuardValue<bool> TickingGuard(bTicking, true);
+
+    int32 NumTicked = 0;
+    for (const FCandidate& Candidate : Candidates)
+    {
+        if (NumTicked >= StateTreeScheduler::MinTicksPerFrame && FPlatformTime::Seconds() - StartTime >= BudgetSeconds) break;
+
+        FEntry& Entry = Entries[Candidate.EntryIndex];
+        UStateTreeComponent* StateTree = Entry.StateTree.Get();
+
+        // Unregistered or destroyed by an earlier tree this frame
+        if (!StateTree) continue;
+
+        // Hand the tree the full time since it last ran so timers and delays don't drift when it is deferred
+        const float TreeDelta = FMath::Min(static_cast<float>(Now - Entry.LastTickTime), StateTreeScheduler::MaxDeltaTime);
+        Entry.LastTickTime = Now;
+
+        StateTree->TickComponent(TreeDelta, LEVELTICK_All, &StateTree->PrimaryComponentTick);
+        ++NumTicked;
+    }
+
+    INC_DWORD_STAT_BY(STAT_AILOD_TreesTicked, NumTicked);
+    INC_DWORD_STAT_BY(STAT_AILOD_TreesDeferred, Candidates.Num() - NumTicked);
+}
+
+TStatId UStateTreeSchedulerSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UStateTreeSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+bool UStateTreeSchedulerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
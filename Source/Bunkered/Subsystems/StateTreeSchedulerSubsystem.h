@@ -0,0 +1,65 @@
+// Subsystems/StateTreeSchedulerSubsystem.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "StateTreeSchedulerSubsystem.generated.h"
+
+class UStateTreeComponent;
+class UAISignificanceComponent;
+class APawn;
+
+/**
+ * Takes over StateTree ticking for registered AI and runs as many trees per frame as fit in a millisecond budget
+ * (Bunker.AI.StateTreeBudgetMs). Trees are picked by significance weight x time since their last tick; each tick
+ * gets the real elapsed time so skipped frames are caught up rather than lost. A tree's own tick interval (set by
+ * the significance tiers) is still honoured as a minimum spacing.
+ */
+UCLASS()
+class BUNKERED_API UStateTreeSchedulerSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Stops the component ticking itself and schedules it here. Significance is optional. */
+    void Register(UStateTreeComponent* StateTree, UAISignificanceComponent* Significance);
+    void Unregister(UStateTreeComponent* StateTree);
+
+    /** AI controller glue for OnPossess: schedules StateTree in its world, using the pawn's significance if it has one */
+    static void RegisterPossessed(UStateTreeComponent* StateTree, const APawn* Pawn);
+
+    /** AI controller glue for OnUnPossess/EndPlay; bRestoreComponentTick hands ticking back to the component */
+    static void UnregisterFromWorld(UStateTreeComponent* StateTree, bool bRestoreComponentTick);
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    int32 GetNumRegistered() const { return Entries.Num(); }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FEntry
+    {
+        TWeakObjectPtr<UStateTreeComponent> StateTree;
+        TWeakObjectPtr<UAISignificanceComponent> Significance;
+        double LastTickTime = 0.0;
+    };
+
+    struct FCandidate
+    {
+        float Priority = 0.f;
+        int32 EntryIndex = INDEX_NONE;
+    };
+
+    TArray<FEntry> Entries;
+
+    /** Set while trees tick; Unregister then only clears the entry so candidate indices stay valid */
+    bool bTicking = false;
+
+    /** Reused per-frame scratch */
+    TArray<FCandidate> Candidates;
+
+    float GetPriorityWeight(const FEntry& Entry) const;
+};
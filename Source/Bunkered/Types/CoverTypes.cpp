@@ -2,3 +2,63 @@
 
 
 #include "Types/CoverTypes.h"
+
+ECoverStance FCoverSlot::GetDefaultStance() const
+{
+	if (AllowsStance(ECoverStance::Crouch)) return ECoverStance::Crouch;
+	if (AllowsStance(ECoverStance::Stand)) return ECoverStance::Stand;
+	if (AllowsStance(ECoverStance::Prone)) return ECoverStance::Prone;
+	return ECoverStance::Crouch;
+}
+
+void FCoverSlot::PostSerialize(const FArchive& Ar)
+{
+#if WITH_EDITORONLY_DATA
+	if (!Ar.IsLoading()) return;
+
+	// Old assets: a non-empty list restricts, an empty one left the mask at its all-allowed default
+	if (AllowedStances_DEPRECATED.Num() > 0)
+	{
+		StanceMask = 0;
+		for (const ECoverStance Stance : AllowedStances_DEPRECATED)
+		{
+			StanceMask |= CoverStanceBit(Stance);
+		}
+		AllowedStances_DEPRECATED.Empty();
+	}
+
+	if (AllowedPeeks_DEPRECATED.Num() > 0)
+	{
+		PeekMask = 0;
+		for (const EPeekDirection Peek : AllowedPeeks_DEPRECATED)
+		{
+			PeekMask |= CoverPeekBit(Peek);
+		}
+		AllowedPeeks_DEPRECATED.Empty();
+	}
+#endif
+}
+
+void UCoverSlotLibrary::SetStanceAllowed(FCoverSlot& Slot, ECoverStance Stance, bool bAllowed)
+{
+	if (bAllowed)
+	{
+		Slot.StanceMask |= CoverStanceBit(Stance);
+	}
+	else
+	{
+		Slot.StanceMask &= ~CoverStanceBit(Stance);
+	}
+}
+
+void UCoverSlotLibrary::SetPeekAllowed(FCoverSlot& Slot, EPeekDirection Peek, bool bAllowed)
+{
+	if (bAllowed)
+	{
+		Slot.PeekMask |= CoverPeekBit(Peek);
+	}
+	else
+	{
+		Slot.PeekMask &= ~CoverPeekBit(Peek);
+	}
+}
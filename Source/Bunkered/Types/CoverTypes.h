@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/EngineTypes.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
 #include "CoverTypes.generated.h"
 
 /**
@@ -27,6 +28,33 @@ enum class EPeekDirection : uint8
 	Over  UMETA(DisplayName="Over")
 };
 
+/** Bit per ECoverStance, for FCoverSlot::StanceMask */
+UENUM(meta=(Bitflags, UseEnumValuesAsMaskValuesInEditor="true"))
+enum class ECoverStanceFlags : uint8
+{
+	None   = 0 UMETA(Hidden),
+	Stand  = 1 << 0,
+	Crouch = 1 << 1,
+	Prone  = 1 << 2,
+	All    = 0x7 UMETA(Hidden)
+};
+ENUM_CLASS_FLAGS(ECoverStanceFlags)
+
+/** Bit per peekable EPeekDirection (None has no bit), for FCoverSlot::PeekMask */
+UENUM(meta=(Bitflags, UseEnumValuesAsMaskValuesInEditor="true"))
+enum class ECoverPeekFlags : uint8
+{
+	None  = 0 UMETA(Hidden),
+	Left  = 1 << 0,
+	Right = 1 << 1,
+	Over  = 1 << 2,
+	All   = 0x7 UMETA(Hidden)
+};
+ENUM_CLASS_FLAGS(ECoverPeekFlags)
+
+FORCEINLINE uint8 CoverStanceBit(ECoverStance Stance) { return 1u << static_cast<uint8>(Stance); }
+FORCEINLINE uint8 CoverPeekBit(EPeekDirection Peek) { return Peek == EPeekDirection::None ? 0 : 1u << (static_cast<uint8>(Peek) - 1); }
+
 UENUM(BlueprintType)
 enum class EExposureState : uint8
 {
@@ -52,13 +80,13 @@ struct FCoverSlot
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Cover Slot")
 	FTransform LocalAnchor = FTransform::Identity;
 
-	/** Which stances are permitted at this slot. Empty = all allowed (designer convenience). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Cover Slot")
-	TArray<ECoverStance> AllowedStances;
+	/** Which stances are permitted at this slot (ECoverStanceFlags). Blueprints use UCoverSlotLibrary. */
+	UPROPERTY(EditAnywhere, Category="Cover Slot", meta=(Bitmask, BitmaskEnum="/Script/Bunkered.ECoverStanceFlags"))
+	uint8 StanceMask = static_cast<uint8>(ECoverStanceFlags::All);
 
-	/** Which peek directions are allowed. Empty = all allowed. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Cover Slot")
-	TArray<EPeekDirection> AllowedPeeks;
+	/** Which peek directions are allowed (ECoverPeekFlags). Blueprints use UCoverSlotLibrary. */
+	UPROPERTY(EditAnywhere, Category="Cover Slot", meta=(Bitmask, BitmaskEnum="/Script/Bunkered.ECoverPeekFlags"))
+	uint8 PeekMask = static_cast<uint8>(ECoverPeekFlags::All);
 
 	/** Radius used to "snap-in" to this slot when entering cover. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Cover Slot", meta=(ClampMin="0.0", UIMin="0.0"))
@@ -78,4 +106,55 @@ struct FCoverSlot
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Cover Slot")
 	float VerticalPeekOffset = 20.f;
-};
\ No newline at end of file
+
+#if WITH_EDITORONLY_DATA
+	/** Pre-bitmask stance list (empty meant all); folded into StanceMask on load */
+	UPROPERTY()
+	TArray<ECoverStance> AllowedStances_DEPRECATED;
+
+	/** Pre-bitmask peek list (empty meant all); folded into PeekMask on load */
+	UPROPERTY()
+	TArray<EPeekDirection> AllowedPeeks_DEPRECATED;
+#endif
+
+	bool AllowsStance(ECoverStance Stance) const { return (StanceMask & CoverStanceBit(Stance)) != 0; }
+	bool AllowsPeek(EPeekDirection Peek) const { return Peek == EPeekDirection::None || (PeekMask & CoverPeekBit(Peek)) != 0; }
+
+	/** Stance taken on entering the slot: crouch when allowed, else the first allowed one */
+	ECoverStance GetDefaultStance() const;
+
+	/** Migrates the deprecated arrays into the masks */
+	void PostSerialize(const FArchive& Ar);
+};
+
+template<>
+struct TStructOpsTypeTraits<FCoverSlot> : public TStructOpsTypeTraitsBase2<FCoverSlot>
+{
+	enum
+	{
+		WithPostSerialize = true,
+	};
+};
+
+/** Blueprint access to FCoverSlot's stance and peek masks (uint8 bitmasks can't be exposed as properties) */
+UCLASS()
+class BUNKERED_API UCoverSlotLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	UFUNCTION(BlueprintPure, Category="Cover Slot")
+	static bool AllowsStance(const FCoverSlot& Slot, ECoverStance Stance) { return Slot.AllowsStance(Stance); }
+
+	/** None is always allowed */
+	UFUNCTION(BlueprintPure, Category="Cover Slot")
+	static bool AllowsPeek(const FCoverSlot& Slot, EPeekDirection Peek) { return Slot.AllowsPeek(Peek); }
+
+	UFUNCTION(BlueprintCallable, Category="Cover Slot")
+	static void SetStanceAllowed(UPARAM(ref) FCoverSlot& Slot, ECoverStance Stance, bool bAllowed);
+
+	/** Ignored for None, which has no bit */
+	UFUNCTION(BlueprintCallable, Category="Cover Slot")
+	static void SetPeekAllowed(UPARAM(ref) FCoverSlot& Slot, EPeekDirection Peek, bool bAllowed);
+};
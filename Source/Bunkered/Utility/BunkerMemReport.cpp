@@ -0,0 +1,108 @@
+// Utility/BunkerMemReport.cpp
+#include "Utility/BunkerProfiling.h"
+#include "Bunkers/BunkerBase.h"
+#include "Components/BunkerAdvisorComponent.h"
+#include "Subsystems/BunkerSlotSubsystem.h"
+#include "Subsystems/HealthOverlaySubsystem.h"
+#include "CombatEnemySpawner.h"
+#include "EngineUtils.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "UObject/UObjectIterator.h"
+
+namespace BunkerMemReport
+{
+    double KiB(SIZE_T Bytes) { return Bytes / 1024.0; }
+
+    void Run(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+    {
+        if (!World)
+        {
+            Ar.Log(TEXT("Bunker.MemReport: no world"));
+            return;
+        }
+
+        // -verbose lists every bunker and advisor, not just the totals and the largest entries
+        const bool bVerbose = Args.Contains(TEXT("-verbose"));
+
+        Ar.Logf(TEXT("=== Bunker.MemReport (%s) ==="), *World->GetMapName());
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+        Ar.Log(TEXT("LLM totals per tag (Bunker_*, Combat_EnemyPool, Gameplay_UI): stat LLMFULL, or -llmcsv for a timeline"));
+#else
+        Ar.Log(TEXT("LLM compiled out in this build; container sizes only"));
+#endif
+
+        // Slot store
+        if (const UBunkerSlotSubsystem* SlotStore = World->GetSubsystem<UBunkerSlotSubsystem>())
+        {
+            Ar.Logf(TEXT("Slot store: %d slots, %.1f KiB"), SlotStore->GetNumSlots(), KiB(SlotStore->GetAllocatedSize()));
+        }
+
+        // Per-bunker slot arrays
+        int32 NumBunkers = 0, NumSlots = 0;
+        SIZE_T SlotBytes = 0;
+        const ABunkerBase* Largest = nullptr;
+        for (TActorIterator<ABunkerBase> It(World); It; ++It)
+        {
+            const SIZE_T Bytes = It->GetSlotsAllocatedSize();
+            ++NumBunkers;
+            NumSlots += It->GetNumSlots();
+            SlotBytes += Bytes;
+            if (!Largest || Bytes > Largest->GetSlotsAllocatedSize()) Largest = *It;
+
+            if (bVerbose)
+            {
+                Ar.Logf(TEXT("  %-40s %3d slots %8llu B"), *It->GetName(), It->GetNumSlots(), static_cast<uint64>(Bytes));
+            }
+        }
+        Ar.Logf(TEXT("Bunkers: %d, %d slots, %.1f KiB in slot arrays (%.0f B per bunker)"),
+            NumBunkers, NumSlots, KiB(SlotBytes), NumBunkers ? static_cast<double>(SlotBytes) / NumBunkers : 0.0);
+        if (Largest)
+        {
+            Ar.Logf(TEXT("  largest: %s, %d slots, %llu B"), *Largest->GetName(), Largest->GetNumSlots(), static_cast<uint64>(Largest->GetSlotsAllocatedSize()));
+        }
+
+        // Advisor scratch
+        int32 NumAdvisors = 0, Capacity = 0, MaxCapacity = 0;
+        SIZE_T AdvisorBytes = 0;
+        for (TObjectIterator<UBunkerAdvisorComponent> It; It; ++It)
+        {
+            if (It->GetWorld() != World || It->IsTemplate()) continue;
+
+            ++NumAdvisors;
+            Capacity += It->GetScratchCapacity();
+            MaxCapacity = FMath::Max(MaxCapacity, It->GetScratchCapacity());
+            AdvisorBytes += It->GetScratchAllocatedSize();
+
+            if (bVerbose)
+            {
+                Ar.Logf(TEXT("  %-40s capacity %5d %8llu B"), *GetNameSafe(It->GetOwner()), It->GetScratchCapacity(), static_cast<uint64>(It->GetScratchAllocatedSize()));
+            }
+        }
+        Ar.Logf(TEXT("Advisors: %d, scratch capacity %d candidates (max %d), %.1f KiB"), NumAdvisors, Capacity, MaxCapacity, KiB(AdvisorBytes));
+
+        // Combat enemy pools
+        int32 NumSpawners = 0, Pooled = 0, Created = 0;
+        SIZE_T PoolBytes = 0;
+        for (TActorIterator<ACombatEnemySpawner> It(World); It; ++It)
+        {
+            ++NumSpawners;
+            Pooled += It->GetNumPooled();
+            Created += It->GetNumCreated();
+            PoolBytes += It->GetPoolAllocatedSize();
+        }
+        Ar.Logf(TEXT("Enemy pools: %d spawners, %d enemies created, %d dormant, %llu B in pool arrays"), NumSpawners, Created, Pooled, static_cast<uint64>(PoolBytes));
+
+        // Health bar overlay
+        if (const UHealthOverlaySubsystem* Overlay = World->GetSubsystem<UHealthOverlaySubsystem>())
+        {
+            Ar.Logf(TEXT("Health bars: %d, %.1f KiB"), Overlay->GetBars().Num(), KiB(Overlay->GetAllocatedSize()));
+        }
+    }
+
+    static FAutoConsoleCommandWithWorldArgsAndOutputDevice MemReportCommand(
+        TEXT("Bunker.MemReport"),
+        TEXT("Dumps memory held by bunker and combat systems (slot store, per-bunker slots, advisor scratch, enemy pools, health bars). -verbose lists every bunker and advisor."),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&Run));
+}
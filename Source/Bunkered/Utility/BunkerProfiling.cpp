@@ -0,0 +1,22 @@
+// Utility/BunkerProfiling.cpp
+#include "Utility/BunkerProfiling.h"
+
+CSV_DEFINE_CATEGORY_MODULE(BUNKERED_API, Bunker, true);
+
+DEFINE_STAT(STAT_Bunker_GatherCandidates);
+DEFINE_STAT(STAT_Bunker_ScoreCandidate);
+DEFINE_STAT(STAT_Bunker_IsSlotExposed);
+DEFINE_STAT(STAT_Bunker_FindClosestValidSlot);
+DEFINE_STAT(STAT_Bunker_SnapOwnerToSlot);
+DEFINE_STAT(STAT_Bunker_OnRepSlot);
+DEFINE_STAT(STAT_Bunker_OnRepStanceExposure);
+DEFINE_STAT(STAT_Bunker_OnRepPeek);
+
+DEFINE_STAT(STAT_Bunker_CandidatesGathered);
+DEFINE_STAT(STAT_Bunker_TracesIssued);
+DEFINE_STAT(STAT_Bunker_SuggestionsChanged);
+
+LLM_DEFINE_TAG(Bunker_Slots);
+LLM_DEFINE_TAG(Bunker_Advisor);
+LLM_DEFINE_TAG(Combat_EnemyPool);
+LLM_DEFINE_TAG(Gameplay_UI);
@@ -0,0 +1,57 @@
+// Utility/BunkerProfiling.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+/**
+ * Shared profiling hooks for bunker gameplay code.
+ * CSV stats land in the "Bunker" category of any csvprofile capture (including the soak harness's).
+ * Cycle stats and counters show under `stat bunker`.
+ */
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(BUNKERED_API, Bunker);
+
+DECLARE_STATS_GROUP(TEXT("Bunker"), STATGROUP_Bunker, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GatherCandidates"), STAT_Bunker_GatherCandidates, STATGROUP_Bunker, BUNKERED_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ScoreCandidate"), STAT_Bunker_ScoreCandidate, STATGROUP_Bunker, BUNKERED_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("IsSlotExposedToEnemies"), STAT_Bunker_IsSlotExposed, STATGROUP_Bunker, BUNKERED_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("FindClosestValidSlot"), STAT_Bunker_FindClosestValidSlot, STATGROUP_Bunker, BUNKERED_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SnapOwnerToSlot"), STAT_Bunker_SnapOwnerToSlot, STATGROUP_Bunker, BUNKERED_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnRep_Slot"), STAT_Bunker_OnRepSlot, STATGROUP_Bunker, BUNKERED_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnRep_StanceExposure"), STAT_Bunker_OnRepStanceExposure, STATGROUP_Bunker, BUNKERED_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("OnRep_Peek"), STAT_Bunker_OnRepPeek, STATGROUP_Bunker, BUNKERED_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Candidates gathered"), STAT_Bunker_CandidatesGathered, STATGROUP_Bunker, BUNKERED_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Traces issued"), STAT_Bunker_TracesIssued, STATGROUP_Bunker, BUNKERED_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Suggestions changed"), STAT_Bunker_SuggestionsChanged, STATGROUP_Bunker, BUNKERED_API);
+
+/**
+ * LLM tags for gameplay memory (run with -llm, view with `stat LLMFULL` or -llmcsv).
+ * Bunker.MemReport prints the matching container sizes per system.
+ */
+LLM_DECLARE_TAG_API(Bunker_Slots, BUNKERED_API);
+LLM_DECLARE_TAG_API(Bunker_Advisor, BUNKERED_API);
+LLM_DECLARE_TAG_API(Combat_EnemyPool, BUNKERED_API);
+LLM_DECLARE_TAG_API(Gameplay_UI, BUNKERED_API);
+
+/**
+ * Times a scope under a STATGROUP_Bunker cycle stat. Cycle stats already emit Insights CPU events, so builds
+ * without stats (Test, server configs with stats off) fall back to a plain trace scope of the same name.
+ */
+#if STATS
+#define BUNKER_SCOPE_CYCLE_COUNTER(Stat) SCOPE_CYCLE_COUNTER(Stat)
+#else
+#define BUNKER_SCOPE_CYCLE_COUNTER(Stat) TRACE_CPUPROFILER_EVENT_SCOPE(Stat)
+#endif
+
+/** Adds to a per-frame STATGROUP_Bunker counter (STAT_Bunker_<Name>) and the matching CSV stat */
+#define BUNKER_COUNTER_ADD(Name, Amount)                                                            \
+    do                                                                                              \
+    {                                                                                               \
+        INC_DWORD_STAT_BY(STAT_Bunker_##Name, Amount);                                              \
+        CSV_CUSTOM_STAT(Bunker, Name, static_cast<int32>(Amount), ECsvCustomStatOp::Accumulate);    \
+    } while (0)
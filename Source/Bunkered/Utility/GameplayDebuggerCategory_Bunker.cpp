@@ -0,0 +1,174 @@
+// Utility/GameplayDebuggerCategory_Bunker.cpp
+#include "Utility/GameplayDebuggerCategory_Bunker.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "Bunkers/BunkerBase.h"
+#include "Components/BunkerAdvisorComponent.h"
+#include "Components/BunkerCoverComponent.h"
+#include "Subsystems/BunkerSlotSubsystem.h"
+#include "Subsystems/PlayerSnapshotSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+namespace BunkerDebugger
+{
+    /** Slots further than this from the debug actor aren't drawn */
+    constexpr float SlotRadius = 2500.f;
+
+    /** Scored candidates listed and labelled */
+    constexpr int32 MaxCandidates = 8;
+
+    /** Eye height for exposure rays, matches the advisor and slot store */
+    constexpr float EyeHeight = 60.f;
+
+    FVector PeekPoint(const ABunkerBase& Bunker, int32 SlotIndex, EPeekDirection Peek)
+    {
+        const FCoverSlot& Slot = Bunker.GetSlot(SlotIndex);
+        FVector LocalOffset = FVector::ZeroVector;
+        switch (Peek)
+        {
+        case EPeekDirection::Left:  LocalOffset.Y = -Slot.LateralPeekOffset; break;
+        case EPeekDirection::Right: LocalOffset.Y = +Slot.LateralPeekOffset; break;
+        case EPeekDirection::Over:  LocalOffset.Z = +Slot.VerticalPeekOffset; break;
+        default: break;
+        }
+        return Bunker.GetSlotWorldTransform(SlotIndex).TransformPosition(LocalOffset);
+    }
+}
+
+FGameplayDebuggerCategory_Bunker::FGameplayDebuggerCategory_Bunker()
+{
+    bShowOnlyWithDebugActor = false;
+}
+
+TSharedRef<FGameplayDebuggerCategory> FGameplayDebuggerCategory_Bunker::MakeInstance()
+{
+    return MakeShareable(new FGameplayDebuggerCategory_Bunker());
+}
+
+void FGameplayDebuggerCategory_Bunker::CollectData(APlayerController* OwnerPC, AActor* DebugActor)
+{
+    const AActor* Subject = DebugActor ? DebugActor : (OwnerPC ? OwnerPC->GetPawn() : nullptr);
+    UWorld* World = Subject ? Subject->GetWorld() : nullptr;
+    if (!World)
+    {
+        AddTextLine(TEXT("{red}No debug actor or pawn"));
+        return;
+    }
+
+    const FVector Origin = Subject->GetActorLocation();
+    AddTextLine(FString::Printf(TEXT("{white}Subject: {yellow}%s"), *Subject->GetName()));
+
+    // Slots around the subject: green free, orange occupied; label is cached player exposure
+    if (const UBunkerSlotSubsystem* SlotStore = World->GetSubsystem<UBunkerSlotSubsystem>())
+    {
+        int32 NumShown = 0, NumOccupied = 0;
+        const float RadiusSq = FMath::Square(BunkerDebugger::SlotRadius);
+        for (int32 SlotId = 0; SlotId < SlotStore->GetNumSlots(); ++SlotId)
+        {
+            if (!SlotStore->IsValidSlot(SlotId)) continue;
+
+            const FVector& Location = SlotStore->GetLocation(SlotId);
+            if (FVector::DistSquared(Location, Origin) > RadiusSq) continue;
+
+            const bool bOccupied = SlotStore->GetOccupant(SlotId) != nullptr;
+            AddShape(FGameplayDebuggerShape::MakePoint(Location, 8.f, bOccupied ? FColor::Orange : FColor::Green,
+                FString::Printf(TEXT("%.0f%%"), 100.f * SlotStore->GetExposure(SlotId))));
+            AddShape(FGameplayDebuggerShape::MakeSegment(Location, Location + SlotStore->GetForward(SlotId) * 40.f, 1.f, FColor::Green));
+
+            ++NumShown;
+            NumOccupied += bOccupied ? 1 : 0;
+        }
+        AddTextLine(FString::Printf(TEXT("{white}Slots nearby: {yellow}%d {white}occupied: {yellow}%d {white}(of %d)"), NumShown, NumOccupied, SlotStore->GetNumSlots()));
+    }
+
+    // Cover state and peek point
+    const ABunkerBase* ActiveBunker = nullptr;
+    int32 ActiveSlot = INDEX_NONE;
+    if (const UBunkerCoverComponent* Cover = Subject->FindComponentByClass<UBunkerCoverComponent>())
+    {
+        if (Cover->IsInCover())
+        {
+            ActiveBunker = Cover->GetCurrentBunker();
+            ActiveSlot = Cover->GetCurrentSlot();
+            AddTextLine(FString::Printf(TEXT("{white}Cover: {yellow}%s {white}slot {yellow}%d {white}stance {yellow}%s {white}exposure {yellow}%s {white}peek {yellow}%s"),
+                *GetNameSafe(ActiveBunker), ActiveSlot,
+                *StaticEnum<ECoverStance>()->GetNameStringByValue(static_cast<int64>(Cover->GetStance())),
+                *StaticEnum<EExposureState>()->GetNameStringByValue(static_cast<int64>(Cover->GetExposureState())),
+                *StaticEnum<EPeekDirection>()->GetNameStringByValue(static_cast<int64>(Cover->GetPeek()))));
+
+            if (ActiveBunker && Cover->GetPeek() != EPeekDirection::None)
+            {
+                const FVector SlotLocation = ActiveBunker->GetSlotWorldTransform(ActiveSlot).GetLocation();
+                const FVector Peek = BunkerDebugger::PeekPoint(*ActiveBunker, ActiveSlot, Cover->GetPeek());
+                AddShape(FGameplayDebuggerShape::MakeSegment(SlotLocation, Peek, 2.f, FColor::Red));
+                AddShape(FGameplayDebuggerShape::MakePoint(Peek, 5.f, FColor::Red, TEXT("peek")));
+            }
+        }
+        else
+        {
+            AddTextLine(TEXT("{white}Cover: {grey}none"));
+        }
+    }
+
+    // Advisor suggestion and the best-scored candidates
+    if (const UBunkerAdvisorComponent* Advisor = Subject->FindComponentByClass<UBunkerAdvisorComponent>())
+    {
+        const FBunkerCandidate Suggestion = Advisor->GetSuggestion();
+        if (Suggestion.IsValid())
+        {
+            AddTextLine(FString::Printf(TEXT("{white}Suggestion: {green}%s {white}slot {green}%d {white}score {green}%.2f"),
+                *GetNameSafe(Suggestion.Bunker), Suggestion.SlotIndex, Suggestion.Score));
+            AddShape(FGameplayDebuggerShape::MakeSegment(Origin, Suggestion.SlotTransform.GetLocation(), 2.f, FColor::Cyan));
+
+            if (!ActiveBunker)
+            {
+                ActiveBunker = Suggestion.Bunker;
+                ActiveSlot = Suggestion.SlotIndex;
+            }
+        }
+        else
+        {
+            AddTextLine(TEXT("{white}Suggestion: {grey}none"));
+        }
+
+        TArray<FBunkerCandidate> Candidates;
+        Advisor->GetDebugCandidates(Candidates);
+        for (int32 i = 0; i < FMath::Min(Candidates.Num(), BunkerDebugger::MaxCandidates); ++i)
+        {
+            const FBunkerCandidate& C = Candidates[i];
+            AddTextLine(FString::Printf(TEXT("  {white}%d. %s slot %d: {yellow}%.2f"), i + 1, *GetNameSafe(C.Bunker), C.SlotIndex, C.Score));
+            AddShape(FGameplayDebuggerShape::MakePoint(C.SlotTransform.GetLocation() + FVector(0.f, 0.f, 30.f), 4.f, FColor::Cyan,
+                FString::Printf(TEXT("%.2f"), C.Score)));
+        }
+    }
+
+    // Player exposure rays to the active slot (in cover, else the suggestion): red sees it, green is blocked.
+    // Same channel as the slot store's cached exposure, so the rays agree with the slot labels
+    if (ActiveBunker && ActiveSlot != INDEX_NONE)
+    {
+        if (const FPlayerSnapshot* Snapshot = UPlayerSnapshotSubsystem::GetSnapshot(World))
+        {
+            const UBunkerSlotSubsystem* SlotStore = World->GetSubsystem<UBunkerSlotSubsystem>();
+            const ECollisionChannel Channel = SlotStore ? SlotStore->VisibilityChannel : ECC_Visibility;
+            const FVector SlotLocation = ActiveBunker->GetSlotWorldTransform(ActiveSlot).GetLocation();
+            for (const FPlayerSnapshotEntry& Player : Snapshot->Players)
+            {
+                const APawn* Pawn = Player.Pawn.Get();
+                if (!Pawn || Pawn == Subject) continue;
+
+                FCollisionQueryParams Params(SCENE_QUERY_STAT(BunkerDebugExposure), false, Pawn);
+                Params.AddIgnoredActor(Subject);
+
+                FHitResult Hit;
+                const FVector Eye = Player.Location + FVector(0.f, 0.f, BunkerDebugger::EyeHeight);
+                const bool bHit = World->LineTraceSingleByChannel(Hit, Eye, SlotLocation, Channel, Params);
+                const bool bExposed = !bHit || ActiveBunker->IsSlotOwnCover(ActiveSlot, Hit);
+                AddShape(FGameplayDebuggerShape::MakeSegment(Eye, bExposed ? SlotLocation : Hit.ImpactPoint, 1.5f, bExposed ? FColor::Red : FColor::Green));
+            }
+        }
+    }
+}
+
+#endif // WITH_GAMEPLAY_DEBUGGER
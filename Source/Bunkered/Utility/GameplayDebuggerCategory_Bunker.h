@@ -0,0 +1,28 @@
+// Utility/GameplayDebuggerCategory_Bunker.h
+#pragma once
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "CoreMinimal.h"
+#include "GameplayDebuggerCategory.h"
+
+class APlayerController;
+
+/**
+ * "Bunker" gameplay debugger category (apostrophe key, then the category's number).
+ * For the debug actor (or the viewing player's pawn): nearby slots with occupancy and cached exposure, the cover
+ * state and peek point, the advisor's suggestion and best-scored candidates, and player exposure rays to the
+ * active slot. Data is only gathered on the server while the category is enabled and replicated to the debugging
+ * client by the gameplay debugger.
+ */
+class FGameplayDebuggerCategory_Bunker : public FGameplayDebuggerCategory
+{
+public:
+    FGameplayDebuggerCategory_Bunker();
+
+    virtual void CollectData(APlayerController* OwnerPC, AActor* DebugActor) override;
+
+    static TSharedRef<FGameplayDebuggerCategory> MakeInstance();
+};
+
+#endif // WITH_GAMEPLAY_DEBUGGER
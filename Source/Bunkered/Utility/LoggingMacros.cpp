@@ -1,4 +1,38 @@
-// Fill out your copyright notice in the Description page of Project Settings.
+// Utility/LoggingMacros.cpp
+#include "Utility/LoggingMacros.h"
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
 
+DEFINE_LOG_CATEGORY(LogBunkerCover);
+DEFINE_LOG_CATEGORY(LogBunkerInput);
+DEFINE_LOG_CATEGORY(LogBunkerNav);
 
-#include "Utility/LoggingMacros.h"
+#if BUNKER_LOGGING_ENABLED
+
+namespace BunkerLog
+{
+    static TAutoConsoleVariable<int32> CVarOnScreen(
+        TEXT("Bunker.Log.OnScreen"),
+        0,
+        TEXT("Also print bunker log messages on screen. 0: off, 1: warnings and errors, 2: up to Log, 3: everything that passes the category filter."));
+
+    constexpr float OnScreenTime = 5.f;
+
+    void PrintOnScreen(ELogVerbosity::Type Verbosity, const FString& Message)
+    {
+        const int32 Level = CVarOnScreen.GetValueOnAnyThread();
+        if (Level <= 0 || !GEngine) return;
+
+        const ELogVerbosity::Type Max = Level == 1 ? ELogVerbosity::Warning
+                                      : Level == 2 ? ELogVerbosity::Log
+                                      : ELogVerbosity::All;
+        if ((Verbosity & ELogVerbosity::VerbosityMask) > Max) return;
+
+        const FColor Color = Verbosity <= ELogVerbosity::Error ? FColor::Red
+                           : Verbosity == ELogVerbosity::Warning ? FColor::Yellow
+                           : FColor::Cyan;
+        GEngine->AddOnScreenDebugMessage(-1, OnScreenTime, Color, Message);
+    }
+}
+
+#endif
@@ -1,29 +1,50 @@
-// Fill out your copyright notice in the Description page of Project Settings.
-
+// Utility/LoggingMacros.h
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Engine/Engine.h"
+#include "Logging/LogMacros.h"
 
 /**
- * Used for debugging and logging
-*/
+ * Bunker logging.
+ *
+ *   BUNKER_LOG(LogBunkerCover, Verbose, TEXT("Peek=%s"), *Name);
+ *
+ * Goes to the log like UE_LOG and, with Bunker.Log.OnScreen, to the screen. Filtered per category at runtime
+ * ("Log LogBunkerCover VeryVerbose" in the console, or -LogCmds=) and at compile time by the category's max
+ * verbosity; arguments are only evaluated when the message is going to be printed.
+ * Compiled out entirely (arguments included) in Shipping and Test.
+ */
 
-// You can change this to your own category if you like
-#ifndef DEBUG_LOG_CATEGORY
-#define DEBUG_LOG_CATEGORY LogTemp
-#endif
+#define BUNKER_LOGGING_ENABLED !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 
-#define DEBUG(Time, Color, Format, ...)                                                        \
-do {                                                                                           \
-const FString _DbgMsg = FString::Printf(Format, ##__VA_ARGS__);                            \
-if (GEngine) {                                                                             \
-GEngine->AddOnScreenDebugMessage(-1, Time, Color, _DbgMsg);                            \
-}                                                                                          \
-UE_LOG(DEBUG_LOG_CATEGORY, Log, TEXT("%s"), *_DbgMsg);                                     \
-} while (0)
+BUNKERED_API DECLARE_LOG_CATEGORY_EXTERN(LogBunkerCover, Log, All);
+BUNKERED_API DECLARE_LOG_CATEGORY_EXTERN(LogBunkerInput, Log, All);
+BUNKERED_API DECLARE_LOG_CATEGORY_EXTERN(LogBunkerNav, Log, All);
 
+#if BUNKER_LOGGING_ENABLED
 
-class BUNKERED_API LoggingMacros
+namespace BunkerLog
 {
-};
+    /** Mirrors an already-filtered message to the screen if Bunker.Log.OnScreen allows its verbosity */
+    BUNKERED_API void PrintOnScreen(ELogVerbosity::Type Verbosity, const FString& Message);
+}
+
+#define BUNKER_LOG(CategoryName, Verbosity, Format, ...)                                                      \
+    do                                                                                                        \
+    {                                                                                                         \
+        if constexpr ((ELogVerbosity::Verbosity & ELogVerbosity::VerbosityMask) <= FLogCategory##CategoryName::CompileTimeVerbosity) \
+        {                                                                                                     \
+            if (!CategoryName.IsSuppressed(ELogVerbosity::Verbosity))                                         \
+            {                                                                                                 \
+                const FString BunkerLogMessage = FString::Printf(Format, ##__VA_ARGS__);                     \
+                UE_LOG(CategoryName, Verbosity, TEXT("%s"), *BunkerLogMessage);                                \
+                BunkerLog::PrintOnScreen(ELogVerbosity::Verbosity, BunkerLogMessage);                          \
+            }                                                                                                 \
+        }                                                                                                     \
+    } while (0)
+
+#else
+
+#define BUNKER_LOG(CategoryName, Verbosity, Format, ...) do {} while (0)
+
+#endif
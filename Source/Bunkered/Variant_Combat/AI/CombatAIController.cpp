@@ -3,6 +3,7 @@
 
 #include "CombatAIController.h"
 #include "Components/StateTreeAIComponent.h"
+#include "Subsystems/StateTreeSchedulerSubsystem.h"
 
 ACombatAIController::ACombatAIController()
 {
@@ -17,3 +18,27 @@ ACombatAIController::ACombatAIController()
 	// this is necessary for EnvQueries to work correctly
 	bAttachToPawn = true;
 }
+
+void ACombatAIController::OnPossess(APawn* InPawn)
+{
+	Super::OnPossess(InPawn);
+
+	// let the scheduler tick our StateTree within its frame budget
+	UStateTreeSchedulerSubsystem::RegisterPossessed(StateTreeAI, InPawn);
+}
+
+void ACombatAIController::OnUnPossess()
+{
+	// take StateTree ticking back from the scheduler
+	UStateTreeSchedulerSubsystem::UnregisterFromWorld(StateTreeAI, /*bRestoreComponentTick=*/true);
+
+	Super::OnUnPossess();
+}
+
+void ACombatAIController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// make sure the scheduler doesn't hold on to us
+	UStateTreeSchedulerSubsystem::UnregisterFromWorld(StateTreeAI, /*bRestoreComponentTick=*/false);
+
+	Super::EndPlay(EndPlayReason);
+}
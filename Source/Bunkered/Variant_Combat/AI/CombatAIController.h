@@ -24,4 +24,15 @@ public:
 
 	/** Constructor */
 	ACombatAIController();
+
+protected:
+
+	/** Hands StateTree ticking over to the scheduler */
+	virtual void OnPossess(APawn* InPawn) override;
+
+	/** Returns StateTree ticking to the component */
+	virtual void OnUnPossess() override;
+
+	/** Cleanup */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 };
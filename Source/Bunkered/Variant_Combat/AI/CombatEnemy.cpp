@@ -5,17 +5,26 @@
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "CombatAIController.h"
-#include "Components/WidgetComponent.h"
 #include "Engine/DamageEvents.h"
-#include "CombatLifeBar.h"
 #include "TimerManager.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Animation/AnimInstance.h"
+#include "Components/AISignificanceComponent.h"
+#include "Subsystems/MeleeTraceSubsystem.h"
+#include "Subsystems/RagdollBudgetSubsystem.h"
+#include "UObject/ConstructorHelpers.h"
+#include "Subsystems/HealthOverlaySubsystem.h"
+#include "CombatEnemySpawner.h"
+#include "BrainComponent.h"
 
 ACombatEnemy::ACombatEnemy()
 {
 	PrimaryActorTick.bCanEverTick = true;
 
+	// default over-budget death animation, for characters on the mannequin skeleton
+	static ConstructorHelpers::FObjectFinder<UAnimSequenceBase> DefaultDeathAnimation(TEXT("/Game/Characters/Mannequins/Anims/Death/MM_Death_Front_01.MM_Death_Front_01"));
+	DeathAnimation = DefaultDeathAnimation.Object;
+
 	// bind the attack montage ended delegate
 	OnAttackMontageEnded.BindUObject(this, &ACombatEnemy::AttackMontageEnded);
 
@@ -28,9 +37,8 @@ ACombatEnemy::ACombatEnemy()
 	// ignore the controller's yaw rotation
 	bUseControllerRotationYaw = false;
 
-	// create the life bar
-	LifeBar = CreateDefaultSubobject<UWidgetComponent>(TEXT("LifeBar"));
-	LifeBar->SetupAttachment(RootComponent);
+	// create the significance component
+	Significance = CreateDefaultSubobject<UAISignificanceComponent>(TEXT("Significance"));
 
 	// set the collision capsule size
 	GetCapsuleComponent()->SetCapsuleSize(35.0f, 90.0f);
@@ -59,6 +67,9 @@ void ACombatEnemy::DoAIComboAttack()
 	// reset the attack counter
 	CurrentComboAttack = 0;
 
+	// start a new melee swing so its traces can hit each actor once
+	UMeleeTraceSubsystem::BeginSwing(this);
+
 	// play the attack montage
 	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
 	{
@@ -90,6 +101,9 @@ void ACombatEnemy::DoAIChargedAttack()
 	// reset the charge loop counter
 	CurrentChargeLoop = 0;
 
+	// start a new melee swing so its traces can hit each actor once
+	UMeleeTraceSubsystem::BeginSwing(this);
+
 	// play the attack montage
 	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
 	{
@@ -109,15 +123,15 @@ void ACombatEnemy::AttackMontageEnded(UAnimMontage* Montage, bool bInterrupted)
 	// reset the attacking flag
 	bIsAttacking = false;
 
+	// forget the swing's hits
+	UMeleeTraceSubsystem::EndSwing(this);
+
 	// call the attack completed delegate so the StateTree can continue execution
 	OnAttackCompleted.ExecuteIfBound();
 }
 
 void ACombatEnemy::DoAttackTrace(FName DamageSourceBone)
 {
-	// sweep for objects in front of the character to be hit by the attack
-	TArray<FHitResult> OutHits;
-
 	// start at the provided socket location, sweep forward
 	const FVector TraceStart = GetMesh()->GetSocketLocation(DamageSourceBone);
 	const FVector TraceEnd = TraceStart + (GetActorForwardVector() * MeleeTraceDistance);
@@ -126,36 +140,29 @@ void ACombatEnemy::DoAttackTrace(FName DamageSourceBone)
 	FCollisionObjectQueryParams ObjectParams;
 	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
 
-	// use a sphere shape for the sweep
-	FCollisionShape CollisionShape;
-	CollisionShape.SetSphere(MeleeTraceRadius);
+	// the sweep runs with the frame's other melee traces; hits come back through HandleAttackHit, once per actor per swing
+	if (UMeleeTraceSubsystem* MeleeTraces = GetWorld()->GetSubsystem<UMeleeTraceSubsystem>())
+	{
+		MeleeTraces->QueueSweep(this, TraceStart, TraceEnd, MeleeTraceRadius, ObjectParams);
+	}
+}
 
-	// ignore self
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
+void ACombatEnemy::HandleAttackHit(const FHitResult& Hit)
+{
+	/** does the actor have the player tag? */
+	if (!Hit.GetActor()->ActorHasTag(FName("Player")))
+	{
+		return;
+	}
 
-	if (GetWorld()->SweepMultiByObjectType(OutHits, TraceStart, TraceEnd, FQuat::Identity, ObjectParams, CollisionShape, QueryParams))
+	// check if the actor is damageable
+	if (ICombatDamageable* Damageable = Cast<ICombatDamageable>(Hit.GetActor()))
 	{
-		// iterate over each object hit
-		for (const FHitResult& CurrentHit : OutHits)
-		{
-			/** does the actor have the player tag? */
-			if (CurrentHit.GetActor()->ActorHasTag(FName("Player")))
-			{
-				// check if the actor is damageable
-				ICombatDamageable* Damageable = Cast<ICombatDamageable>(CurrentHit.GetActor());
-
-				if (Damageable)
-				{
-					// knock upwards and away from the impact normal
-					const FVector Impulse = (CurrentHit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
-
-					// pass the damage event to the actor
-					Damageable->ApplyDamage(MeleeDamage, this, CurrentHit.ImpactPoint, Impulse);
-
-				}
-			}
-		}
+		// knock upwards and away from the impact normal
+		const FVector Impulse = (Hit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
+
+		// pass the damage event to the actor
+		Damageable->ApplyDamage(MeleeDamage, this, Hit.ImpactPoint, Impulse);
 	}
 }
 
@@ -167,6 +174,9 @@ void ACombatEnemy::CheckCombo()
 	// do we still have attacks to play in this string?
 	if (CurrentComboAttack < TargetComboCount)
 	{
+		// each attack in the string is its own swing
+		UMeleeTraceSubsystem::BeginSwing(this);
+
 		// jump to the next attack section
 		if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
 		{
@@ -180,6 +190,9 @@ void ACombatEnemy::CheckChargedAttack()
 	// increase the charge loop counter
 	++CurrentChargeLoop;
 
+	// the released attack is a new swing
+	UMeleeTraceSubsystem::BeginSwing(this);
+
 	// jump to either the loop or attack section of the montage depending on whether we hit the loop target
 	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
 	{
@@ -222,7 +235,10 @@ void ACombatEnemy::ApplyDamage(float Damage, AActor* DamageCauser, const FVector
 void ACombatEnemy::HandleDeath()
 {
 	// hide the life bar
-	LifeBar->SetHiddenInGame(true);
+	if (UHealthOverlaySubsystem* Overlay = GetWorld()->GetSubsystem<UHealthOverlaySubsystem>())
+	{
+		Overlay->SetVisible(this, false);
+	}
 
 	// disable the collision capsule to avoid being hit again while dead
 	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
@@ -230,8 +246,11 @@ void ACombatEnemy::HandleDeath()
 	// disable character movement
 	GetCharacterMovement()->DisableMovement();
 
-	// enable full ragdoll physics
-	GetMesh()->SetSimulatePhysics(true);
+	// enable full ragdoll physics if the ragdoll budget allows, otherwise play the canned death
+	if (URagdollBudgetSubsystem* Ragdolls = GetWorld()->GetSubsystem<URagdollBudgetSubsystem>())
+	{
+		Ragdolls->BeginRagdoll(GetMesh(), DeathAnimation);
+	}
 
 	// call the died delegate to notify any subscribers
 	OnEnemyDied.Broadcast();
@@ -247,10 +266,96 @@ void ACombatEnemy::ApplyHealing(float Healing, AActor* Healer)
 
 void ACombatEnemy::RemoveFromLevel()
 {
+	// hand ourselves back to the spawner so the next spawn can reuse us
+	if (ACombatEnemySpawner* Spawner = PoolOwner.Get())
+	{
+		Spawner->ReturnToPool(this);
+		return;
+	}
+
 	// destroy this actor
 	Destroy();
 }
 
+void ACombatEnemy::DeactivateForPool()
+{
+	// make sure a pending removal doesn't fire while we're pooled
+	GetWorld()->GetTimerManager().ClearTimer(DeathTimer);
+
+	// stop the StateTree before the montages, so ending them doesn't advance any task
+	if (AAIController* AIController = Cast<AAIController>(GetController()))
+	{
+		if (UBrainComponent* Brain = AIController->GetBrainComponent())
+		{
+			Brain->StopLogic(TEXT("Pooled"));
+		}
+	}
+
+	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
+	{
+		AnimInstance->StopAllMontages(0.0f);
+	}
+	bIsAttacking = false;
+
+	// turn the ragdoll off (undoing any freeze) and snap the mesh back onto the capsule
+	if (URagdollBudgetSubsystem* Ragdolls = GetWorld()->GetSubsystem<URagdollBudgetSubsystem>())
+	{
+		Ragdolls->ReleaseRagdoll(GetMesh());
+	}
+	GetMesh()->SetSimulatePhysics(false);
+	GetMesh()->SetPhysicsBlendWeight(0.0f);
+	GetMesh()->AttachToComponent(GetCapsuleComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+	GetMesh()->SetRelativeTransform(MeshRelativeTransform);
+
+	// stop moving
+	GetCharacterMovement()->StopMovementImmediately();
+	GetCharacterMovement()->DisableMovement();
+
+	// go dormant. The mesh and movement tick on their own, and significance would re-enable movement, so stop all three
+	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+	Significance->SetSuspended(true);
+	GetMesh()->SetComponentTickEnabled(false);
+	GetCharacterMovement()->SetComponentTickEnabled(false);
+}
+
+void ACombatEnemy::ActivateFromPool(const FTransform& SpawnTransform)
+{
+	// move to the spawn point
+	SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+
+	// reset HP and the life bar
+	CurrentHP = MaxHP;
+	if (UHealthOverlaySubsystem* Overlay = GetWorld()->GetSubsystem<UHealthOverlaySubsystem>())
+	{
+		Overlay->SetPercent(this, 1.0f);
+		Overlay->SetVisible(this, true);
+	}
+
+	// restore collision and movement
+	GetCapsuleComponent()->SetCollisionEnabled(CapsuleCollision);
+	GetCharacterMovement()->SetDefaultMovementMode();
+
+	// wake up. Significance goes last so it can re-apply its tier on top of the restored ticks
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(true);
+	GetMesh()->SetComponentTickEnabled(true);
+	GetCharacterMovement()->SetComponentTickEnabled(true);
+	Significance->SetSuspended(false);
+
+	// run the StateTree again from its root state
+	if (AAIController* AIController = Cast<AAIController>(GetController()))
+	{
+		if (UBrainComponent* Brain = AIController->GetBrainComponent())
+		{
+			Brain->RestartLogic();
+		}
+	}
+}
+
 float ACombatEnemy::TakeDamage(float Damage, struct FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
 {
 	// only process damage if the character is still alive
@@ -271,11 +376,17 @@ float ACombatEnemy::TakeDamage(float Damage, struct FDamageEvent const& DamageEv
 	else
 	{
 		// update the life bar
-		LifeBarWidget->SetLifePercentage(CurrentHP / MaxHP);
+		if (UHealthOverlaySubsystem* Overlay = GetWorld()->GetSubsystem<UHealthOverlaySubsystem>())
+		{
+			Overlay->SetPercent(this, CurrentHP / MaxHP);
+		}
 
-		// enable partial ragdoll physics, but keep the pelvis vertical
-		GetMesh()->SetPhysicsBlendWeight(0.5f);
-		GetMesh()->SetBodySimulatePhysics(PelvisBoneName, false);
+		// enable partial ragdoll physics if the ragdoll budget allows, but keep the pelvis vertical
+		URagdollBudgetSubsystem* Ragdolls = GetWorld()->GetSubsystem<URagdollBudgetSubsystem>();
+		if (Ragdolls && Ragdolls->BeginHitReaction(GetMesh(), 0.5f))
+		{
+			GetMesh()->SetBodySimulatePhysics(PelvisBoneName, false);
+		}
 	}
 
 	// return the received damage amount
@@ -290,7 +401,10 @@ void ACombatEnemy::Landed(const FHitResult& Hit)
 	if (CurrentHP >= 0.0f)
 	{
 		// disable ragdoll physics
-		GetMesh()->SetPhysicsBlendWeight(0.0f);
+		if (URagdollBudgetSubsystem* Ragdolls = GetWorld()->GetSubsystem<URagdollBudgetSubsystem>())
+		{
+			Ragdolls->EndHitReaction(GetMesh());
+		}
 	}
 
 	// call the landed Delegate for StateTree
@@ -305,12 +419,15 @@ void ACombatEnemy::BeginPlay()
 	// we top the HP before BeginPlay so StateTree picks it up at the right value
 	Super::BeginPlay();
 
-	// get the life bar widget from the widget comp
-	LifeBarWidget = Cast<UCombatLifeBar>(LifeBar->GetUserWidgetObject());
-	check(LifeBarWidget);
+	// add a full life bar to the HUD overlay
+	if (UHealthOverlaySubsystem* Overlay = GetWorld()->GetSubsystem<UHealthOverlaySubsystem>())
+	{
+		Overlay->AddBar(this, LifeBarColor, LifeBarHeight);
+	}
 
-	// fill the life bar
-	LifeBarWidget->SetLifePercentage(1.0f);
+	// remember how to undo the death ragdoll, so we can be pooled
+	MeshRelativeTransform = GetMesh()->GetRelativeTransform();
+	CapsuleCollision = GetCapsuleComponent()->GetCollisionEnabled();
 }
 
 void ACombatEnemy::EndPlay(EEndPlayReason::Type EndPlayReason)
@@ -319,4 +436,10 @@ void ACombatEnemy::EndPlay(EEndPlayReason::Type EndPlayReason)
 
 	// clear the death timer
 	GetWorld()->GetTimerManager().ClearTimer(DeathTimer);
+
+	// remove our life bar from the HUD overlay
+	if (UHealthOverlaySubsystem* Overlay = GetWorld()->GetSubsystem<UHealthOverlaySubsystem>())
+	{
+		Overlay->RemoveBar(this);
+	}
 }
@@ -10,9 +10,10 @@
 #include "Engine/TimerHandle.h"
 #include "CombatEnemy.generated.h"
 
-class UWidgetComponent;
-class UCombatLifeBar;
 class UAnimMontage;
+class UAnimSequenceBase;
+class UAISignificanceComponent;
+class ACombatEnemySpawner;
 
 /** Completed attack animation delegate for StateTree */
 DECLARE_DELEGATE(FOnEnemyAttackCompleted);
@@ -32,9 +33,9 @@ class ACombatEnemy : public ACharacter, public ICombatAttacker, public ICombatDa
 {
 	GENERATED_BODY()
 
-	/** Life bar widget component */
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = UI, meta = (AllowPrivateAccess = "true"))
-	UWidgetComponent* LifeBar;
+	/** Scales AI, animation and movement updates down with distance from the players */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = AI, meta = (AllowPrivateAccess = "true"))
+	UAISignificanceComponent* Significance;
 
 public:
 	
@@ -59,9 +60,13 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Damage")
 	FName PelvisBoneName;
 
-	/** Pointer to the life bar widget */
-	UPROPERTY(EditAnywhere, Category="Damage")
-	UCombatLifeBar* LifeBarWidget;
+	/** Life bar fill color */
+	UPROPERTY(EditAnywhere, Category="UI")
+	FLinearColor LifeBarColor = FLinearColor::Red;
+
+	/** Height of the life bar above the actor's origin */
+	UPROPERTY(EditAnywhere, Category="UI", meta = (ClampMin = 0, ClampMax = 500, Units = "cm"))
+	float LifeBarHeight = 120.0f;
 
 	/** If true, the character is currently playing an attack animation */
 	bool bIsAttacking = false;
@@ -130,9 +135,22 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Death")
 	float DeathRemovalTime = 5.0f;
 
+	/** Death animation played instead of a ragdoll when too many ragdolls are simulating. A montage or a sequence (played in the DefaultSlot); holds its last frame */
+	UPROPERTY(EditAnywhere, Category="Death")
+	UAnimSequenceBase* DeathAnimation;
+
 	/** Enemy death timer */
 	FTimerHandle DeathTimer;
 
+	/** Spawner that recycles this enemy after death. If unset, the enemy is destroyed instead */
+	TWeakObjectPtr<ACombatEnemySpawner> PoolOwner;
+
+	/** Mesh placement relative to the capsule, restored after ragdolling */
+	FTransform MeshRelativeTransform;
+
+	/** Capsule collision setting, restored when reused from the pool */
+	ECollisionEnabled::Type CapsuleCollision = ECollisionEnabled::QueryAndPhysics;
+
 	/** Attack montage ended delegate */
 	FOnMontageEnded OnAttackMontageEnded;
 
@@ -173,6 +191,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Attacker")
 	virtual void CheckChargedAttack() override;
 
+	/** Applies damage to a player hit by a queued attack trace */
+	virtual void HandleAttackHit(const FHitResult& Hit) override;
+
 	// ~end ICombatAttacker interface
 
 	// ~begin ICombatDamageable interface
@@ -193,6 +214,17 @@ protected:
 	/** Removes this character from the level after it dies */
 	void RemoveFromLevel();
 
+public:
+
+	/** Sets the spawner this enemy returns to instead of being destroyed */
+	void SetPoolOwner(ACombatEnemySpawner* Spawner) { PoolOwner = Spawner; }
+
+	/** Puts a dead or freshly pre-warmed enemy to sleep: hidden, no collision, no ticking, StateTree stopped, ragdoll reset */
+	void DeactivateForPool();
+
+	/** Wakes a pooled enemy at the given transform with full HP and a fresh StateTree */
+	void ActivateFromPool(const FTransform& SpawnTransform);
+
 public:
 
 	/** Overrides the default TakeDamage functionality */
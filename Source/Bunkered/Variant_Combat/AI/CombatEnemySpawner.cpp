@@ -7,6 +7,7 @@
 #include "Components/ArrowComponent.h"
 #include "TimerManager.h"
 #include "CombatEnemy.h"
+#include "Utility/BunkerProfiling.h"
 
 ACombatEnemySpawner::ACombatEnemySpawner()
 {
@@ -30,6 +31,18 @@ ACombatEnemySpawner::ACombatEnemySpawner()
 void ACombatEnemySpawner::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// pre-warm the pool so waves don't construct actors, widgets and controllers mid-fight
+	LLM_SCOPE_BYTAG(Combat_EnemyPool);
+	const int32 WarmCount = FMath::Min(PoolSize, SpawnCount);
+	for (int32 i = 0; i < WarmCount; ++i)
+	{
+		if (ACombatEnemy* Enemy = CreateEnemy())
+		{
+			Enemy->DeactivateForPool();
+			Pool.Add(Enemy);
+		}
+	}
 	
 	// should we spawn an enemy right away?
 	if (bShouldSpawnEnemiesImmediately)
@@ -46,26 +59,84 @@ void ACombatEnemySpawner::EndPlay(EEndPlayReason::Type EndPlayReason)
 
 	// clear the spawn timer
 	GetWorld()->GetTimerManager().ClearTimer(SpawnTimer);
+
+	// pooled enemies are never spawned again, so get rid of them with us
+	for (ACombatEnemy* Enemy : Pool)
+	{
+		if (IsValid(Enemy))
+		{
+			Enemy->Destroy();
+		}
+	}
+	Pool.Empty();
 }
 
 void ACombatEnemySpawner::SpawnEnemy()
+{
+	// reuse a pooled enemy if we have one, otherwise grow the pool
+	ACombatEnemy* Enemy = nullptr;
+	while (!Enemy && Pool.Num() > 0)
+	{
+		Enemy = Pool.Pop(EAllowShrinking::No);
+		if (!IsValid(Enemy))
+		{
+			Enemy = nullptr;
+		}
+	}
+
+	if (!Enemy)
+	{
+		Enemy = CreateEnemy();
+	}
+
+	// was the enemy successfully created?
+	if (Enemy)
+	{
+		// wake the enemy at the reference capsule's transform
+		Enemy->ActivateFromPool(SpawnCapsule->GetComponentTransform());
+	}
+}
+
+ACombatEnemy* ACombatEnemySpawner::CreateEnemy()
 {
 	// ensure the enemy class is valid
-	if (IsValid(EnemyClass))
+	if (!IsValid(EnemyClass))
 	{
-		// spawn the enemy at the reference capsule's transform
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+		return nullptr;
+	}
 
-		ACombatEnemy* SpawnedEnemy = GetWorld()->SpawnActor<ACombatEnemy>(EnemyClass, SpawnCapsule->GetComponentTransform(), SpawnParams);
+	// spawned enemies and everything they create belong to the pool
+	LLM_SCOPE_BYTAG(Combat_EnemyPool);
 
-		// was the enemy successfully created?
-		if (SpawnedEnemy)
-		{
-			// subscribe to the death delegate
-			SpawnedEnemy->OnEnemyDied.AddDynamic(this, &ACombatEnemySpawner::OnEnemyDied);
-		}
+	// spawn the enemy at the reference capsule's transform
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	ACombatEnemy* SpawnedEnemy = GetWorld()->SpawnActor<ACombatEnemy>(EnemyClass, SpawnCapsule->GetComponentTransform(), SpawnParams);
+
+	if (SpawnedEnemy)
+	{
+		// pooled enemies come back to us instead of being destroyed
+		SpawnedEnemy->SetPoolOwner(this);
+		++NumCreated;
+
+		// subscribe to the death delegate once; it stays bound across reuse
+		SpawnedEnemy->OnEnemyDied.AddDynamic(this, &ACombatEnemySpawner::OnEnemyDied);
 	}
+
+	return SpawnedEnemy;
+}
+
+void ACombatEnemySpawner::ReturnToPool(ACombatEnemy* Enemy)
+{
+	if (!IsValid(Enemy))
+	{
+		return;
+	}
+
+	LLM_SCOPE_BYTAG(Combat_EnemyPool);
+	Enemy->DeactivateForPool();
+	Pool.Add(Enemy);
 }
 
 void ACombatEnemySpawner::OnEnemyDied()
@@ -50,6 +50,14 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Enemy Spawner", meta = (ClampMin = 0, ClampMax = 10))
 	float RespawnDelay = 5.0f;
 
+	/** Number of enemies created up front and recycled after death. Two covers one alive while another is dying */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Enemy Spawner|Pool", meta = (ClampMin = 0, ClampMax = 20))
+	int32 PoolSize = 2;
+
+	/** Dormant enemies ready to be reused */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ACombatEnemy>> Pool;
+
 	/** Time to wait after this spawner is depleted before activating the actor list */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Activation", meta = (ClampMin = 0, ClampMax = 10))
 	float ActivationDelay = 1.0f;
@@ -58,6 +66,9 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Activation")
 	TArray<AActor*> ActorsToActivateWhenDepleted;
 
+	/** Enemies this spawner has created over its lifetime (pooled or live) */
+	int32 NumCreated = 0;
+
 	/** Flag to ensure this is only activated once */
 	bool bHasBeenActivated = false;
 
@@ -79,9 +90,12 @@ public:
 
 protected:
 
-	/** Spawn an enemy and subscribe to its death event */
+	/** Spawn an enemy (reusing a pooled one if available) and subscribe to its death event */
 	void SpawnEnemy();
 
+	/** Creates a new enemy owned by this spawner's pool */
+	ACombatEnemy* CreateEnemy();
+
 	/** Called when the spawned enemy has died */
 	UFUNCTION()
 	void OnEnemyDied();
@@ -89,6 +103,16 @@ protected:
 	/** Called after the last spawned enemy has died */
 	void SpawnerDepleted();
 
+public:
+
+	/** Takes back a dead enemy for reuse */
+	void ReturnToPool(ACombatEnemy* Enemy);
+
+	/** Pool stats for Bunker.MemReport */
+	int32 GetNumPooled() const { return Pool.Num(); }
+	int32 GetNumCreated() const { return NumCreated; }
+	SIZE_T GetPoolAllocatedSize() const { return Pool.GetAllocatedSize(); }
+
 public:
 
 	// ~begin ICombatActivatable interface
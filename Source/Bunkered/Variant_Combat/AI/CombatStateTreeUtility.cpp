@@ -8,7 +8,7 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "AIController.h"
 #include "CombatEnemy.h"
-#include "Kismet/GameplayStatics.h"
+#include "Subsystems/PlayerSnapshotSubsystem.h"
 #include "StateTreeAsyncExecutionContext.h"
 
 bool FStateTreeCharacterGroundedCondition::TestCondition(FStateTreeExecutionContext& Context) const
@@ -266,14 +266,37 @@ EStateTreeRunStatus FStateTreeGetPlayerInfoTask::Tick(FStateTreeExecutionContext
 	// get the instance data
 	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
-	// get the character possessed by the first local player
-	InstanceData.TargetPlayerCharacter = Cast<ACharacter>(UGameplayStatics::GetPlayerPawn(InstanceData.Character, 0));
+	// get this frame's player snapshot
+	const FPlayerSnapshot* Snapshot = UPlayerSnapshotSubsystem::GetSnapshot(InstanceData.Character);
+
+	// pick the requested player, or the closest one
+	InstanceData.TargetPlayerIndex = INDEX_NONE;
+	if (Snapshot)
+	{
+		if (InstanceData.PlayerIndex == INDEX_NONE)
+		{
+			float DistSq = 0.0f;
+			InstanceData.TargetPlayerIndex = Snapshot->FindClosest(InstanceData.Character->GetActorLocation(), DistSq);
+		}
+		else if (Snapshot->IsValidIndex(InstanceData.PlayerIndex))
+		{
+			InstanceData.TargetPlayerIndex = InstanceData.PlayerIndex;
+		}
+	}
 
 	// do we have a valid target?
-	if (InstanceData.TargetPlayerCharacter)
+	if (InstanceData.TargetPlayerIndex != INDEX_NONE)
+	{
+		const FPlayerSnapshotEntry& Player = (*Snapshot)[InstanceData.TargetPlayerIndex];
+
+		// update the last known location and velocity
+		InstanceData.TargetPlayerCharacter = Cast<ACharacter>(Player.Pawn.Get());
+		InstanceData.TargetPlayerLocation = Player.Location;
+		InstanceData.TargetPlayerVelocity = Player.Velocity;
+	}
+	else
 	{
-		// update the last known location
-		InstanceData.TargetPlayerLocation = InstanceData.TargetPlayerCharacter->GetActorLocation();
+		InstanceData.TargetPlayerCharacter = nullptr;
 	}
 
 	// update the distance
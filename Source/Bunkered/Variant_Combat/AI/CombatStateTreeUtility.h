@@ -277,6 +277,14 @@ struct FStateTreeGetPlayerInfoInstanceData
 	UPROPERTY(EditAnywhere, Category = Context)
 	TObjectPtr<ACharacter> Character;
 
+	/** Player to track. INDEX_NONE tracks whichever player is closest */
+	UPROPERTY(EditAnywhere, Category = Parameter)
+	int32 PlayerIndex = INDEX_NONE;
+
+	/** Index of the tracked player in this frame's player snapshot */
+	UPROPERTY(VisibleAnywhere)
+	int32 TargetPlayerIndex = INDEX_NONE;
+
 	/** Character that owns this task */
 	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<ACharacter> TargetPlayerCharacter;
@@ -285,6 +293,10 @@ struct FStateTreeGetPlayerInfoInstanceData
 	UPROPERTY(VisibleAnywhere)
 	FVector TargetPlayerLocation;
 
+	/** Last known velocity for the target */
+	UPROPERTY(VisibleAnywhere)
+	FVector TargetPlayerVelocity = FVector::ZeroVector;
+
 	/** Distance to the target */
 	UPROPERTY(VisibleAnywhere)
 	float DistanceToTarget;
@@ -292,6 +304,7 @@ struct FStateTreeGetPlayerInfoInstanceData
 
 /**
  *  StateTree task to get information about the player character
+ *  Reads the shared per-frame player snapshot instead of querying the player pawn directly
  */
 USTRUCT(meta=(DisplayName="GetPlayerInfo", Category="Combat"))
 struct FStateTreeGetPlayerInfoTask : public FStateTreeTaskCommonBase
@@ -2,17 +2,31 @@
 
 
 #include "EnvQueryContext_Player.h"
-#include "Kismet/GameplayStatics.h"
+#include "Subsystems/PlayerSnapshotSubsystem.h"
 #include "EnvironmentQuery/EnvQueryTypes.h"
 #include "EnvironmentQuery/Items/EnvQueryItemType_Actor.h"
 #include "GameFramework/Pawn.h"
 
 void UEnvQueryContext_Player::ProvideContext(FEnvQueryInstance& QueryInstance, FEnvQueryContextData& ContextData) const
 {
-	// get the player pawn for the first local player
-	AActor* PlayerPawn = UGameplayStatics::GetPlayerPawn(QueryInstance.Owner.Get(), 0);
-	check(PlayerPawn);
+	// get this frame's player snapshot
+	const FPlayerSnapshot* Snapshot = UPlayerSnapshotSubsystem::GetSnapshot(QueryInstance.World);
+	if (!Snapshot)
+	{
+		return;
+	}
+
+	// gather every live player pawn
+	TArray<AActor*> PlayerPawns;
+	PlayerPawns.Reserve(Snapshot->Num());
+	for (const FPlayerSnapshotEntry& Player : Snapshot->Players)
+	{
+		if (APawn* Pawn = Player.Pawn.Get())
+		{
+			PlayerPawns.Add(Pawn);
+		}
+	}
 
 	// add the actor data to the context
-	UEnvQueryItemType_Actor::SetContextHelper(ContextData, PlayerPawn);
+	UEnvQueryItemType_Actor::SetContextHelper(ContextData, PlayerPawns);
 }
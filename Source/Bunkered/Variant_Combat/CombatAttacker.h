@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
+#include "Engine/HitResult.h"
 #include "CombatAttacker.generated.h"
 
 /**
@@ -33,4 +34,7 @@ public:
 	/** Performs a charged attack's check to loop the charge animation. Usually called from a montage's AnimNotify */
 	UFUNCTION(BlueprintCallable, Category="Attacker")
 	virtual void CheckChargedAttack() = 0;
+
+	/** Receives each actor hit by a queued attack trace, once per actor per swing. Called by UMeleeTraceSubsystem */
+	virtual void HandleAttackHit(const FHitResult& Hit) = 0;
 };
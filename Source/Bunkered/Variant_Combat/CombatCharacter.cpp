@@ -3,18 +3,20 @@
 
 #include "CombatCharacter.h"
 #include "Components/CapsuleComponent.h"
-#include "Components/WidgetComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Camera/CameraComponent.h"
 #include "EnhancedInputSubsystems.h"
 #include "EnhancedInputComponent.h"
-#include "CombatLifeBar.h"
 #include "Engine/DamageEvents.h"
 #include "TimerManager.h"
 #include "Engine/LocalPlayer.h"
 #include "CombatPlayerController.h"
+#include "Subsystems/MeleeTraceSubsystem.h"
+#include "Subsystems/RagdollBudgetSubsystem.h"
+#include "UObject/ConstructorHelpers.h"
+#include "Subsystems/HealthOverlaySubsystem.h"
 
 DEFINE_LOG_CATEGORY(LogCombatCharacter);
 
@@ -22,6 +24,10 @@ ACombatCharacter::ACombatCharacter()
 {
 	PrimaryActorTick.bCanEverTick = true;
 
+	// default over-budget death animation, for characters on the mannequin skeleton
+	static ConstructorHelpers::FObjectFinder<UAnimSequenceBase> DefaultDeathAnimation(TEXT("/Game/Characters/Mannequins/Anims/Death/MM_Death_Front_01.MM_Death_Front_01"));
+	DeathAnimation = DefaultDeathAnimation.Object;
+
 	// bind the attack montage ended delegate
 	OnAttackMontageEnded.BindUObject(this, &ACombatCharacter::AttackMontageEnded);
 
@@ -45,10 +51,6 @@ ACombatCharacter::ACombatCharacter()
 	FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
 	FollowCamera->bUsePawnControlRotation = false;
 
-	// create the life bar widget component
-	LifeBar = CreateDefaultSubobject<UWidgetComponent>(TEXT("LifeBar"));
-	LifeBar->SetupAttachment(RootComponent);
-
 	// set the player tag
 	Tags.Add(FName("Player"));
 }
@@ -172,7 +174,10 @@ void ACombatCharacter::ResetHP()
 	CurrentHP = MaxHP;
 
 	// update the life bar
-	LifeBarWidget->SetLifePercentage(1.0f);
+	if (UHealthOverlaySubsystem* Overlay = GetWorld()->GetSubsystem<UHealthOverlaySubsystem>())
+	{
+		Overlay->SetPercent(this, 1.0f);
+	}
 }
 
 void ACombatCharacter::ComboAttack()
@@ -183,6 +188,9 @@ void ACombatCharacter::ComboAttack()
 	// reset the combo count
 	ComboCount = 0;
 
+	// start a new melee swing so its traces can hit each actor once
+	UMeleeTraceSubsystem::BeginSwing(this);
+
 	// play the attack montage
 	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
 	{
@@ -206,6 +214,9 @@ void ACombatCharacter::ChargedAttack()
 	// reset the charge loop flag
 	bHasLoopedChargedAttack = false;
 
+	// start a new melee swing so its traces can hit each actor once
+	UMeleeTraceSubsystem::BeginSwing(this);
+
 	// play the charged attack montage
 	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
 	{
@@ -225,6 +236,9 @@ void ACombatCharacter::AttackMontageEnded(UAnimMontage* Montage, bool bInterrupt
 	// reset the attacking flag
 	bIsAttacking = false;
 
+	// forget the swing's hits
+	UMeleeTraceSubsystem::EndSwing(this);
+
 	// check if we have a non-stale cached input
 	if (GetWorld()->GetTimeSeconds() - CachedAttackInputTime <= AttackInputCacheTimeTolerance)
 	{
@@ -244,9 +258,6 @@ void ACombatCharacter::AttackMontageEnded(UAnimMontage* Montage, bool bInterrupt
 
 void ACombatCharacter::DoAttackTrace(FName DamageSourceBone)
 {
-	// sweep for objects in front of the character to be hit by the attack
-	TArray<FHitResult> OutHits;
-
 	// start at the provided socket location, sweep forward
 	const FVector TraceStart = GetMesh()->GetSocketLocation(DamageSourceBone);
 	const FVector TraceEnd = TraceStart + (GetActorForwardVector() * MeleeTraceDistance);
@@ -256,34 +267,26 @@ void ACombatCharacter::DoAttackTrace(FName DamageSourceBone)
 	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
 	ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
 
-	// use a sphere shape for the sweep
-	FCollisionShape CollisionShape;
-	CollisionShape.SetSphere(MeleeTraceRadius);
-
-	// ignore self
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
-
-	if (GetWorld()->SweepMultiByObjectType(OutHits, TraceStart, TraceEnd, FQuat::Identity, ObjectParams, CollisionShape, QueryParams))
+	// the sweep runs with the frame's other melee traces; hits come back through HandleAttackHit, once per actor per swing
+	if (UMeleeTraceSubsystem* MeleeTraces = GetWorld()->GetSubsystem<UMeleeTraceSubsystem>())
 	{
-		// iterate over each object hit
-		for (const FHitResult& CurrentHit : OutHits)
-		{
-			// check if we've hit a damageable actor
-			ICombatDamageable* Damageable = Cast<ICombatDamageable>(CurrentHit.GetActor());
+		MeleeTraces->QueueSweep(this, TraceStart, TraceEnd, MeleeTraceRadius, ObjectParams);
+	}
+}
 
-			if (Damageable)
-			{
-				// knock upwards and away from the impact normal
-				const FVector Impulse = (CurrentHit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
+void ACombatCharacter::HandleAttackHit(const FHitResult& Hit)
+{
+	// check if we've hit a damageable actor
+	if (ICombatDamageable* Damageable = Cast<ICombatDamageable>(Hit.GetActor()))
+	{
+		// knock upwards and away from the impact normal
+		const FVector Impulse = (Hit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
 
-				// pass the damage event to the actor
-				Damageable->ApplyDamage(MeleeDamage, this, CurrentHit.ImpactPoint, Impulse);
+		// pass the damage event to the actor
+		Damageable->ApplyDamage(MeleeDamage, this, Hit.ImpactPoint, Impulse);
 
-				// call the BP handler to play effects, etc.
-				DealtDamage(MeleeDamage, CurrentHit.ImpactPoint);
-			}
-		}
+		// call the BP handler to play effects, etc.
+		DealtDamage(MeleeDamage, Hit.ImpactPoint);
 	}
 }
 
@@ -304,6 +307,9 @@ void ACombatCharacter::CheckCombo()
 			// do we still have a combo section to play?
 			if (ComboCount < ComboSectionNames.Num())
 			{
+				// each combo section is its own swing
+				UMeleeTraceSubsystem::BeginSwing(this);
+
 				// jump to the next combo section
 				if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
 				{
@@ -319,6 +325,9 @@ void ACombatCharacter::CheckChargedAttack()
 	// raise the looped charged attack flag
 	bHasLoopedChargedAttack = true;
 
+	// the released attack is a new swing
+	UMeleeTraceSubsystem::BeginSwing(this);
+
 	// jump to either the loop or the attack section depending on whether we're still holding the charge button
 	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
 	{
@@ -356,11 +365,17 @@ void ACombatCharacter::HandleDeath()
 	// disable movement while we're dead
 	GetCharacterMovement()->DisableMovement();
 
-	// enable full ragdoll physics
-	GetMesh()->SetSimulatePhysics(true);
+	// enable full ragdoll physics if the ragdoll budget allows, otherwise play the canned death
+	if (URagdollBudgetSubsystem* Ragdolls = GetWorld()->GetSubsystem<URagdollBudgetSubsystem>())
+	{
+		Ragdolls->BeginRagdoll(GetMesh(), DeathAnimation);
+	}
 
 	// hide the life bar
-	LifeBar->SetHiddenInGame(true);
+	if (UHealthOverlaySubsystem* Overlay = GetWorld()->GetSubsystem<UHealthOverlaySubsystem>())
+	{
+		Overlay->SetVisible(this, false);
+	}
 
 	// pull back the camera
 	GetCameraBoom()->TargetArmLength = DeathCameraDistance;
@@ -400,11 +415,17 @@ float ACombatCharacter::TakeDamage(float Damage, struct FDamageEvent const& Dama
 	else
 	{
 		// update the life bar
-		LifeBarWidget->SetLifePercentage(CurrentHP / MaxHP);
+		if (UHealthOverlaySubsystem* Overlay = GetWorld()->GetSubsystem<UHealthOverlaySubsystem>())
+		{
+			Overlay->SetPercent(this, CurrentHP / MaxHP);
+		}
 
-		// enable partial ragdoll physics, but keep the pelvis vertical
-		GetMesh()->SetPhysicsBlendWeight(0.5f);
-		GetMesh()->SetBodySimulatePhysics(PelvisBoneName, false);
+		// enable partial ragdoll physics if the ragdoll budget allows, but keep the pelvis vertical
+		URagdollBudgetSubsystem* Ragdolls = GetWorld()->GetSubsystem<URagdollBudgetSubsystem>();
+		if (Ragdolls && Ragdolls->BeginHitReaction(GetMesh(), 0.5f))
+		{
+			GetMesh()->SetBodySimulatePhysics(PelvisBoneName, false);
+		}
 	}
 
 	// return the received damage amount
@@ -419,7 +440,10 @@ void ACombatCharacter::Landed(const FHitResult& Hit)
 	if (CurrentHP >= 0.0f)
 	{
 		// disable ragdoll physics
-		GetMesh()->SetPhysicsBlendWeight(0.0f);
+		if (URagdollBudgetSubsystem* Ragdolls = GetWorld()->GetSubsystem<URagdollBudgetSubsystem>())
+		{
+			Ragdolls->EndHitReaction(GetMesh());
+		}
 	}
 }
 
@@ -427,18 +451,17 @@ void ACombatCharacter::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// get the life bar from the widget component
-	LifeBarWidget = Cast<UCombatLifeBar>(LifeBar->GetUserWidgetObject());
-	check(LifeBarWidget);
-
 	// initialize the camera
 	GetCameraBoom()->TargetArmLength = DefaultCameraDistance;
 
 	// save the relative transform for the mesh so we can reset the ragdoll later
 	MeshStartingTransform = GetMesh()->GetRelativeTransform();
 
-	// set the life bar color
-	LifeBarWidget->SetBarColor(LifeBarColor);
+	// add our life bar to the HUD overlay
+	if (UHealthOverlaySubsystem* Overlay = GetWorld()->GetSubsystem<UHealthOverlaySubsystem>())
+	{
+		Overlay->AddBar(this, LifeBarColor, LifeBarHeight);
+	}
 
 	// reset HP to maximum
 	ResetHP();
@@ -450,6 +473,12 @@ void ACombatCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 	// clear the respawn timer
 	GetWorld()->GetTimerManager().ClearTimer(RespawnTimer);
+
+	// remove our life bar from the HUD overlay
+	if (UHealthOverlaySubsystem* Overlay = GetWorld()->GetSubsystem<UHealthOverlaySubsystem>())
+	{
+		Overlay->RemoveBar(this);
+	}
 }
 
 void ACombatCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
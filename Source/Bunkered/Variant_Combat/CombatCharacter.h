@@ -11,10 +11,9 @@
 
 class USpringArmComponent;
 class UCameraComponent;
+class UAnimSequenceBase;
 class UInputAction;
 struct FInputActionValue;
-class UCombatLifeBar;
-class UWidgetComponent;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogCombatCharacter, Log, All);
 
@@ -38,10 +37,6 @@ class ACombatCharacter : public ACharacter, public ICombatAttacker, public IComb
 	/** Follow camera */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Camera, meta = (AllowPrivateAccess = "true"))
 	UCameraComponent* FollowCamera;
-
-	/** Life bar widget component */
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = UI, meta = (AllowPrivateAccess = "true"))
-	UWidgetComponent* LifeBar;
 	
 protected:
 
@@ -77,18 +72,18 @@ protected:
 	UPROPERTY(VisibleAnywhere, Category="Damage")
 	float CurrentHP = 0.0f;
 
-	/** Life bar widget fill color */
+	/** Life bar fill color */
 	UPROPERTY(EditAnywhere, Category="Damage")
 	FLinearColor LifeBarColor;
 
+	/** Height of the life bar above the actor's origin */
+	UPROPERTY(EditAnywhere, Category="Damage", meta = (ClampMin = 0, ClampMax = 500, Units = "cm"))
+	float LifeBarHeight = 120.0f;
+
 	/** Name of the pelvis bone, for damage ragdoll physics */
 	UPROPERTY(EditAnywhere, Category="Damage")
 	FName PelvisBoneName;
 
-	/** Pointer to the life bar widget */
-	UPROPERTY(EditAnywhere, Category="Damage")
-	TObjectPtr<UCombatLifeBar> LifeBarWidget;
-
 	/** Max amount of time that may elapse for a non-combo attack input to not be considered stale */
 	UPROPERTY(EditAnywhere, Category="Melee Attack", meta = (ClampMin = 0, ClampMax = 5))
 	float AttackInputCacheTimeTolerance = 1.0f;
@@ -160,6 +155,10 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Camera", meta = (ClampMin = 0, ClampMax = 1000, Units = "cm"))
 	float DefaultCameraDistance = 100.0f;
 
+	/** Death animation played instead of a ragdoll when too many ragdolls are simulating. A montage or a sequence (played in the DefaultSlot); holds its last frame */
+	UPROPERTY(EditAnywhere, Category="Death")
+	UAnimSequenceBase* DeathAnimation;
+
 	/** Time to wait before respawning the character */
 	UPROPERTY(EditAnywhere, Category="Respawn", meta = (ClampMin = 0, ClampMax = 10))
 	float RespawnTime = 3.0f;
@@ -249,6 +248,9 @@ public:
 	/** Performs the charged attack hold check */
 	virtual void CheckChargedAttack() override;
 
+	/** Applies damage to an actor hit by a queued attack trace */
+	virtual void HandleAttackHit(const FHitResult& Hit) override;
+
 	// ~end CombatAttacker interface
 
 	// ~begin CombatDamageable interface
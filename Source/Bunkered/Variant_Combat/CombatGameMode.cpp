@@ -2,8 +2,10 @@
 
 
 #include "Variant_Combat/CombatGameMode.h"
+#include "CombatHUD.h"
 
 ACombatGameMode::ACombatGameMode()
 {
-
+	// overhead health bars are drawn by the HUD
+	HUDClass = ACombatHUD::StaticClass();
 }
\ No newline at end of file
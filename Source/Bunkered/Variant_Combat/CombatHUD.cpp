@@ -0,0 +1,60 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "CombatHUD.h"
+#include "GameFramework/PlayerController.h"
+#include "Subsystems/HealthOverlaySubsystem.h"
+#include "Utility/BunkerProfiling.h"
+
+void ACombatHUD::DrawHUD()
+{
+	LLM_SCOPE_BYTAG(Gameplay_UI);
+
+	Super::DrawHUD();
+
+	const UHealthOverlaySubsystem* Overlay = GetWorld()->GetSubsystem<UHealthOverlaySubsystem>();
+	if (!Overlay || !PlayerOwner)
+	{
+		return;
+	}
+
+	// get the camera we're drawing for
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	PlayerOwner->GetPlayerViewPoint(ViewLocation, ViewRotation);
+	const FVector ViewDirection = ViewRotation.Vector();
+
+	const float MaxDistanceSquared = FMath::Square(MaxDrawDistance);
+
+	for (const FHealthBarEntry& Bar : Overlay->GetBars())
+	{
+		const AActor* Actor = Bar.Actor.Get();
+		if (!Bar.bVisible || !Actor || Actor->IsHidden())
+		{
+			continue;
+		}
+
+		const FVector WorldLocation = Actor->GetActorLocation() + FVector(0.0f, 0.0f, Bar.HeightOffset);
+		const FVector ToBar = WorldLocation - ViewLocation;
+
+		// cull distant bars and bars behind the camera
+		const float DistanceSquared = ToBar.SizeSquared();
+		if (DistanceSquared > MaxDistanceSquared || (ToBar | ViewDirection) <= 0.0f)
+		{
+			continue;
+		}
+
+		// shrink the bar with distance
+		const float Scale = FMath::Lerp(1.0f, MinBarScale, FMath::Sqrt(DistanceSquared) / FMath::Max(MaxDrawDistance, 1.0f));
+		const float Width = BarSize.X * Scale;
+		const float Height = BarSize.Y * Scale;
+
+		// center the bar on the projected point
+		const FVector ScreenLocation = Project(WorldLocation, false);
+		const float X = ScreenLocation.X - Width * 0.5f;
+		const float Y = ScreenLocation.Y - Height * 0.5f;
+
+		DrawRect(BackgroundColor, X, Y, Width, Height);
+		DrawRect(Bar.Color, X, Y, Width * Bar.Percent, Height);
+	}
+}
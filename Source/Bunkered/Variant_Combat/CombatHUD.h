@@ -0,0 +1,41 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/HUD.h"
+#include "CombatHUD.generated.h"
+
+/**
+ *  Combat HUD.
+ *  Draws every registered overhead health bar (see UHealthOverlaySubsystem) in a single canvas pass.
+ *  All bars are flat white-texture tiles, so the canvas batches them into one draw.
+ */
+UCLASS()
+class ACombatHUD : public AHUD
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Bars further than this from the camera are not drawn */
+	UPROPERTY(EditAnywhere, Category="Life Bars", meta = (ClampMin = 0, Units = "cm"))
+	float MaxDrawDistance = 3000.0f;
+
+	/** Bar size in screen pixels, at point blank range */
+	UPROPERTY(EditAnywhere, Category="Life Bars")
+	FVector2D BarSize = FVector2D(80.0f, 8.0f);
+
+	/** Bar scale at MaxDrawDistance. Bars shrink linearly towards it with distance */
+	UPROPERTY(EditAnywhere, Category="Life Bars", meta = (ClampMin = 0, ClampMax = 1))
+	float MinBarScale = 0.4f;
+
+	/** Color of the empty part of the bar */
+	UPROPERTY(EditAnywhere, Category="Life Bars")
+	FLinearColor BackgroundColor = FLinearColor(0.0f, 0.0f, 0.0f, 0.6f);
+
+public:
+
+	/** Draws the health overlay */
+	virtual void DrawHUD() override;
+};
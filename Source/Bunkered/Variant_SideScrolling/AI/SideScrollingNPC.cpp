@@ -4,12 +4,16 @@
 #include "SideScrollingNPC.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "TimerManager.h"
+#include "Components/AISignificanceComponent.h"
 
 ASideScrollingNPC::ASideScrollingNPC()
 {
  	PrimaryActorTick.bCanEverTick = true;
 
 	GetCharacterMovement()->MaxWalkSpeed = 150.0f;
+
+	// create the significance component
+	Significance = CreateDefaultSubobject<UAISignificanceComponent>(TEXT("Significance"));
 }
 
 void ASideScrollingNPC::EndPlay(EEndPlayReason::Type EndPlayReason)
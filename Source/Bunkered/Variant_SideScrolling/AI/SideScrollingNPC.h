@@ -7,6 +7,8 @@
 #include "SideScrollingInteractable.h"
 #include "SideScrollingNPC.generated.h"
 
+class UAISignificanceComponent;
+
 /**
  *  Simple platforming NPC
  *  Its behaviors will be dictated by a possessing AI Controller
@@ -17,6 +19,10 @@ class ASideScrollingNPC : public ACharacter, public ISideScrollingInteractable
 {
 	GENERATED_BODY()
 
+	/** Scales AI, animation and movement updates down with distance from the players */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = AI, meta = (AllowPrivateAccess = "true"))
+	UAISignificanceComponent* Significance;
+
 protected:
 
 	/** Horizontal impulse to apply to the NPC when it's interacted with */
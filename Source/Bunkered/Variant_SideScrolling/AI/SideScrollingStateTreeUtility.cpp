@@ -5,20 +5,43 @@
 #include "StateTreeExecutionContext.h"
 #include "StateTreeExecutionTypes.h"
 #include "AIController.h"
-#include "Kismet/GameplayStatics.h"
+#include "Subsystems/PlayerSnapshotSubsystem.h"
 
 EStateTreeRunStatus FStateTreeGetPlayerTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
 {
 	// get the instance data
 	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
-	// set the player pawn as the target
-	InstanceData.TargetPlayer = UGameplayStatics::GetPlayerPawn(InstanceData.Controller.Get(), 0);
+	// reset the target
+	InstanceData.TargetPlayer = nullptr;
+	InstanceData.TargetPlayerIndex = INDEX_NONE;
+	InstanceData.bValidTarget = false;
 
-	// are the NPC and target valid?
-	if (IsValid(InstanceData.TargetPlayer) && IsValid(InstanceData.NPC))
+	// get this frame's player snapshot
+	const FPlayerSnapshot* Snapshot = UPlayerSnapshotSubsystem::GetSnapshot(InstanceData.Controller.Get());
+	if (!Snapshot || !IsValid(InstanceData.NPC))
 	{
-		InstanceData.bValidTarget = FVector::Distance(InstanceData.NPC->GetActorLocation(), InstanceData.TargetPlayer->GetActorLocation()) < InstanceData.RangeMax;
+		return EStateTreeRunStatus::Running;
+	}
+
+	// pick the requested player, or the closest one
+	const FVector NPCLocation = InstanceData.NPC->GetActorLocation();
+	float DistSq = 0.0f;
+	if (InstanceData.PlayerIndex == INDEX_NONE)
+	{
+		InstanceData.TargetPlayerIndex = Snapshot->FindClosest(NPCLocation, DistSq);
+	}
+	else if (Snapshot->IsValidIndex(InstanceData.PlayerIndex))
+	{
+		InstanceData.TargetPlayerIndex = InstanceData.PlayerIndex;
+		DistSq = FVector::DistSquared(NPCLocation, (*Snapshot)[InstanceData.PlayerIndex].Location);
+	}
+
+	// is the target valid and in range?
+	if (InstanceData.TargetPlayerIndex != INDEX_NONE)
+	{
+		InstanceData.TargetPlayer = (*Snapshot)[InstanceData.TargetPlayerIndex].Pawn.Get();
+		InstanceData.bValidTarget = IsValid(InstanceData.TargetPlayer) && DistSq < FMath::Square(InstanceData.RangeMax);
 	}
 
 	return EStateTreeRunStatus::Running;
@@ -25,6 +25,14 @@ struct FStateTreeGetPlayerInstanceData
 	UPROPERTY(VisibleAnywhere, Category = Context)
 	TObjectPtr<AAIController> Controller;
 
+	/** Player to track. INDEX_NONE tracks whichever player is closest */
+	UPROPERTY(EditAnywhere, Category = Parameter)
+	int32 PlayerIndex = INDEX_NONE;
+
+	/** Index of the found player in this frame's player snapshot */
+	UPROPERTY(VisibleAnywhere)
+	int32 TargetPlayerIndex = INDEX_NONE;
+
 	/** Holds the found player pawn */
 	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<APawn> TargetPlayer;
@@ -3,10 +3,17 @@
 
 #include "SideScrollingCameraManager.h"
 #include "GameFramework/Pawn.h"
-#include "Engine/HitResult.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
 #include "CollisionQueryParams.h"
 #include "Engine/World.h"
 
+namespace SideScrollingCamera
+{
+	/** How far below the pawn counts as "about to hit ground" */
+	constexpr float GroundProbeDistance = 1000.0f;
+}
+
 void ASideScrollingCameraManager::UpdateViewTarget(FTViewTarget& OutVT, float DeltaTime)
 {
 	// ensure the view target is a pawn
@@ -57,16 +64,8 @@ void ASideScrollingCameraManager::UpdateViewTarget(FTViewTarget& OutVT, float De
 
 		} else {
 
-			// run a trace below the character to determine if we need to do a height update
-			FHitResult OutHit;
-
-			const FVector End = CurrentActorLocation + FVector(0.0f, 0.0f, -1000.0f);
-
-			FCollisionQueryParams QueryParams;
-			QueryParams.AddIgnoredActor(TargetPawn);
-
 			// only update height if we're not about to hit ground
-			bZUpdate = !GetWorld()->LineTraceSingleByChannel(OutHit, CurrentActorLocation, End, ECC_Visibility, QueryParams);
+			bZUpdate = !IsGroundBelow(TargetPawn, CurrentActorLocation);
 
 		}
 
@@ -102,4 +101,41 @@ void ASideScrollingCameraManager::UpdateViewTarget(FTViewTarget& OutVT, float De
 
 		OutVT.POV.Location = FMath::VInterpTo(CurrentCameraLocation, TargetCameraLocation, DeltaTime, 2.0f);
 	}
-}
\ No newline at end of file
+}
+
+bool ASideScrollingCameraManager::IsGroundBelow(APawn* TargetPawn, const FVector& PawnLocation)
+{
+	// walking characters already know their floor, so reuse the movement component's result
+	if (const ACharacter* Character = Cast<ACharacter>(TargetPawn))
+	{
+		const UCharacterMovementComponent* Movement = Character->GetCharacterMovement();
+		if (Movement && Movement->IsMovingOnGround())
+		{
+			// drop any pending airborne probe so a stale result isn't picked up after the next jump
+			GroundTraceHandle = FTraceHandle();
+			bGroundBelow = Movement->CurrentFloor.bBlockingHit;
+			return bGroundBelow;
+		}
+	}
+
+	UWorld* World = GetWorld();
+
+	// airborne: consume last frame's async probe, if it has completed
+	FTraceDatum Datum;
+	if (GroundTraceHandle.IsValid() && World->QueryTraceData(GroundTraceHandle, Datum))
+	{
+		bGroundBelow = FHitResult::GetFirstBlockingHit(Datum.OutHits) != nullptr;
+		GroundTraceHandle = FTraceHandle();
+	}
+
+	// queue the next probe; until it lands, keep using the last known result
+	if (!GroundTraceHandle.IsValid())
+	{
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SideScrollingCameraGround), false, TargetPawn);
+		const FVector End = PawnLocation + FVector(0.0f, 0.0f, -SideScrollingCamera::GroundProbeDistance);
+
+		GroundTraceHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, PawnLocation, End, ECC_Visibility, QueryParams);
+	}
+
+	return bGroundBelow;
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Camera/PlayerCameraManager.h"
+#include "WorldCollision.h"
 #include "SideScrollingCameraManager.generated.h"
 
 /**
@@ -44,4 +45,13 @@ protected:
 
 	/** First-time update camera setup flag */
 	bool bSetup = true;
+
+	/** Ground probe issued while airborne, read back the following frame */
+	FTraceHandle GroundTraceHandle;
+
+	/** Last known result of the airborne ground probe */
+	bool bGroundBelow = false;
+
+	/** Returns true if there's ground within reach below the pawn, without a synchronous trace */
+	bool IsGroundBelow(APawn* TargetPawn, const FVector& PawnLocation);
 };
@@ -6,12 +6,14 @@
 #include "Blueprint/UserWidget.h"
 #include "SideScrollingUI.h"
 #include "SideScrollingPickup.h"
+#include "Utility/BunkerProfiling.h"
 
 void ASideScrollingGameMode::BeginPlay()
 {
 	Super::BeginPlay();
 
 	// create the game UI
+	LLM_SCOPE_BYTAG(Gameplay_UI);
 	APlayerController* OwningPlayer = UGameplayStatics::GetPlayerController(GetWorld(), 0);
 	
 	UserInterface = CreateWidget<USideScrollingUI>(OwningPlayer, UserInterfaceClass);
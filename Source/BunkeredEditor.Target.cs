@@ -10,6 +10,6 @@ public class BunkeredEditorTarget : TargetRules
 		Type = TargetType.Editor;
 		DefaultBuildSettings = BuildSettingsVersion.V5;
 		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_6;
-		ExtraModuleNames.Add("Bunkered");
+		ExtraModuleNames.AddRange(new string[] { "Bunkered", "BunkeredEditor" });
 	}
 }
@@ -0,0 +1,62 @@
+// BunkerAuthoring.cpp
+#include "BunkerAuthoring.h"
+#include "Bunkers/BunkerBase.h"
+#include "Components/ArrowComponent.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogBunkerAuthoring, Log, All);
+
+void FBunkerAuthoring::RebuildSlotsFromChildren(ABunkerBase& Bunker)
+{
+    Bunker.Slots.Empty();
+
+    TArray<UArrowComponent*> Arrows;
+    Bunker.GetComponents<UArrowComponent>(Arrows);
+
+    for (UArrowComponent* Arrow : Arrows)
+    {
+        if (!Arrow || Arrow == Bunker.GetRootComponent()) continue;
+
+        FCoverSlot NewSlot;
+        NewSlot.SlotName = Arrow->GetFName();
+
+        // Reference the arrow so the slot follows it
+        NewSlot.SlotPoint.OtherActor = &Bunker;
+        NewSlot.SlotPoint.ComponentProperty = Arrow->GetFName();
+        NewSlot.bUseComponentTransform = true;
+        NewSlot.LocalAnchor = FTransform::Identity;
+
+        Bunker.Slots.Add(NewSlot);
+    }
+
+    UE_LOG(LogBunkerAuthoring, Verbose, TEXT("%s: rebuilt %d slot(s) from arrow children"), *Bunker.GetName(), Bunker.Slots.Num());
+}
+
+int32 FBunkerAuthoring::TagAllArrowChildrenAsSlots(ABunkerBase& Bunker)
+{
+    if (Bunker.SlotTag.IsNone()) return 0;
+
+    TArray<UArrowComponent*> Arrows;
+    Bunker.GetComponents<UArrowComponent>(Arrows);
+
+    int32 Tagged = 0;
+    for (UArrowComponent* Arrow : Arrows)
+    {
+        if (Arrow && !Arrow->ComponentHasTag(Bunker.SlotTag))
+        {
+            Arrow->Modify();
+            Arrow->ComponentTags.Add(Bunker.SlotTag);
+            ++Tagged;
+        }
+    }
+
+    UE_LOG(LogBunkerAuthoring, Log, TEXT("%s: tagged %d Arrow component(s) with %s"), *Bunker.GetName(), Tagged, *Bunker.SlotTag.ToString());
+    return Tagged;
+}
+
+void FBunkerAuthoring::HandleBunkerConstructed(ABunkerBase* Bunker)
+{
+    if (Bunker && Bunker->bAutoSyncSlotsFromChildren)
+    {
+        RebuildSlotsFromChildren(*Bunker);
+    }
+}
@@ -0,0 +1,20 @@
+// BunkerAuthoring.h
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ABunkerBase;
+
+/** Editor-side slot authoring for ABunkerBase (was CallInEditor on the actor) */
+class FBunkerAuthoring
+{
+public:
+    /** Rebuilds the bunker's Slots from its Arrow children, one component-referencing slot per arrow */
+    static void RebuildSlotsFromChildren(ABunkerBase& Bunker);
+
+    /** Adds the bunker's SlotTag to all Arrow children missing it. Returns how many were tagged. */
+    static int32 TagAllArrowChildrenAsSlots(ABunkerBase& Bunker);
+
+    /** OnConstruction hook: auto-syncs slots when the bunker asks for it */
+    static void HandleBunkerConstructed(ABunkerBase* Bunker);
+};
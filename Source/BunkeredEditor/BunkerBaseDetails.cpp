@@ -0,0 +1,73 @@
+// BunkerBaseDetails.cpp
+#include "BunkerBaseDetails.h"
+#include "BunkerAuthoring.h"
+#include "Bunkers/BunkerBase.h"
+#include "DetailCategoryBuilder.h"
+#include "DetailLayoutBuilder.h"
+#include "DetailWidgetRow.h"
+#include "ScopedTransaction.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Layout/SWrapBox.h"
+
+#define LOCTEXT_NAMESPACE "BunkerBaseDetails"
+
+namespace BunkerBaseDetails
+{
+    /** Runs Action on every selected bunker inside one undo transaction */
+    FReply ForEachBunker(const TArray<TWeakObjectPtr<UObject>>& Objects, const FText& TransactionName, TFunctionRef<void(ABunkerBase&)> Action)
+    {
+        const FScopedTransaction Transaction(TransactionName);
+        for (const TWeakObjectPtr<UObject>& Object : Objects)
+        {
+            if (ABunkerBase* Bunker = Cast<ABunkerBase>(Object.Get()))
+            {
+                Bunker->Modify();
+                Action(*Bunker);
+            }
+        }
+        return FReply::Handled();
+    }
+}
+
+TSharedRef<IDetailCustomization> FBunkerBaseDetails::MakeInstance()
+{
+    return MakeShared<FBunkerBaseDetails>();
+}
+
+void FBunkerBaseDetails::CustomizeDetails(IDetailLayoutBuilder& DetailBuilder)
+{
+    TArray<TWeakObjectPtr<UObject>> Objects;
+    DetailBuilder.GetObjectsBeingCustomized(Objects);
+
+    IDetailCategoryBuilder& Category = DetailBuilder.EditCategory(TEXT("Cover"));
+    Category.AddCustomRow(LOCTEXT("AuthoringRow", "Slot Authoring"))
+    .WholeRowContent()
+    [
+        SNew(SWrapBox)
+        .UseAllottedSize(true)
+        + SWrapBox::Slot().Padding(2.f)
+        [
+            SNew(SButton)
+            .Text(LOCTEXT("RebuildSlots", "Rebuild Slots From Children"))
+            .ToolTipText(LOCTEXT("RebuildSlotsTip", "Replace Slots with one slot per Arrow child"))
+            .OnClicked_Lambda([Objects]()
+            {
+                return BunkerBaseDetails::ForEachBunker(Objects, LOCTEXT("RebuildSlotsTx", "Rebuild Bunker Slots"),
+                    [](ABunkerBase& Bunker) { FBunkerAuthoring::RebuildSlotsFromChildren(Bunker); });
+            })
+        ]
+        + SWrapBox::Slot().Padding(2.f)
+        [
+            SNew(SButton)
+            .Text(LOCTEXT("TagArrows", "Tag All Arrow Children As Slots"))
+            .ToolTipText(LOCTEXT("TagArrowsTip", "Add the slot tag to every Arrow child that is missing it"))
+            .OnClicked_Lambda([Objects]()
+            {
+                return BunkerBaseDetails::ForEachBunker(Objects, LOCTEXT("TagArrowsTx", "Tag Bunker Arrows"),
+                    [](ABunkerBase& Bunker) { FBunkerAuthoring::TagAllArrowChildrenAsSlots(Bunker); });
+            })
+        ]
+    ];
+}
+
+#undef LOCTEXT_NAMESPACE
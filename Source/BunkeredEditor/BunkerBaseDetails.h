@@ -0,0 +1,14 @@
+// BunkerBaseDetails.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IDetailCustomization.h"
+
+/** Adds the slot authoring buttons to ABunkerBase's details panel */
+class FBunkerBaseDetails : public IDetailCustomization
+{
+public:
+    static TSharedRef<IDetailCustomization> MakeInstance();
+
+    virtual void CustomizeDetails(IDetailLayoutBuilder& DetailBuilder) override;
+};
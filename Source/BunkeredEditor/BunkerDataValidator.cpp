@@ -0,0 +1,82 @@
+// BunkerDataValidator.cpp
+#include "BunkerDataValidator.h"
+#include "Bunkers/BunkerBase.h"
+#include "Bunkers/BunkerFieldGenerator.h"
+#include "DataAsset/BunkerFieldLayout.h"
+#include "DataAsset/BunkerMetaData.h"
+#include "Engine/Blueprint.h"
+#include "Misc/DataValidation.h"
+
+#define LOCTEXT_NAMESPACE "BunkerDataValidator"
+
+namespace BunkerDataValidator
+{
+    /** The object to check: bunker Blueprints are validated through their class default object */
+    const UObject* GetSubject(const UObject* Object)
+    {
+        if (const UBlueprint* Blueprint = Cast<UBlueprint>(Object))
+        {
+            const UClass* GeneratedClass = Blueprint->GeneratedClass;
+            return GeneratedClass && GeneratedClass->IsChildOf<ABunkerBase>() ? GeneratedClass->GetDefaultObject() : nullptr;
+        }
+        return Object;
+    }
+}
+
+bool UBunkerDataValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const
+{
+    const UObject* Subject = BunkerDataValidator::GetSubject(InObject);
+    return Subject && (Subject->IsA<ABunkerBase>() || Subject->IsA<UBunkerMetaData>() || Subject->IsA<UBunkerFieldLayout>());
+}
+
+EDataValidationResult UBunkerDataValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+    const UObject* Subject = BunkerDataValidator::GetSubject(InAsset);
+    bool bFailed = false;
+
+    if (const ABunkerFieldGenerator* Field = Cast<ABunkerFieldGenerator>(Subject))
+    {
+        if (!Field->GetLayout())
+        {
+            AssetFails(InAsset, LOCTEXT("NoLayout", "Bunker field generator has no Layout."));
+            bFailed = true;
+        }
+    }
+    else if (const ABunkerBase* Bunker = Cast<ABunkerBase>(Subject))
+    {
+        // Don't hard-fail. A bunker can exist without slots; just warn designers.
+        if (Bunker->GetNumSlots() == 0)
+        {
+            AssetWarning(InAsset, LOCTEXT("NoSlots", "Bunker has no slots. Add Arrow components and click 'Rebuild Slots From Children', or give its MetaData a SlotTemplate."));
+        }
+    }
+    else if (const UBunkerMetaData* Type = Cast<UBunkerMetaData>(Subject))
+    {
+        if (Type->Mesh.IsNull())
+        {
+            AssetWarning(InAsset, LOCTEXT("NoMesh", "Bunker type has no Mesh; field generators will place invisible cover."));
+        }
+        if (Type->SlotTemplate.Num() == 0)
+        {
+            AssetWarning(InAsset, LOCTEXT("NoSlotTemplate", "Bunker type has no SlotTemplate; generated or slot-less bunkers of this type offer no cover slots."));
+        }
+    }
+    else if (const UBunkerFieldLayout* Layout = Cast<UBunkerFieldLayout>(Subject))
+    {
+        for (int32 i = 0; i < Layout->Entries.Num(); ++i)
+        {
+            if (!Layout->Entries[i].Type)
+            {
+                AssetFails(InAsset, FText::Format(LOCTEXT("NoType", "Layout entry {0} has no bunker Type."), i));
+                bFailed = true;
+            }
+        }
+    }
+
+    if (bFailed) return EDataValidationResult::Invalid;
+
+    AssetPasses(InAsset);
+    return EDataValidationResult::Valid;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,21 @@
+// BunkerDataValidator.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorValidatorBase.h"
+#include "BunkerDataValidator.generated.h"
+
+/**
+ * Data validation for bunker content (was ABunkerBase::IsDataValid): bunkers without slots, field generators
+ * without a layout, archetypes missing a mesh or slot template, and layouts with untyped entries.
+ * Bunker Blueprints are checked through their class default object.
+ */
+UCLASS()
+class UBunkerDataValidator : public UEditorValidatorBase
+{
+    GENERATED_BODY()
+
+protected:
+    virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
+    virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+};
@@ -0,0 +1,23 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class BunkeredEditor : ModuleRules
+{
+	public BunkeredEditor(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(new string[] {
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"UnrealEd",
+			"Slate",
+			"SlateCore",
+			"PropertyEditor",
+			"DataValidation",
+			"Bunkered"
+		});
+	}
+}
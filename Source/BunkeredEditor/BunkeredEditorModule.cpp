@@ -0,0 +1,35 @@
+// BunkeredEditorModule.cpp
+#include "Modules/ModuleManager.h"
+#include "BunkerAuthoring.h"
+#include "BunkerBaseDetails.h"
+#include "Bunkers/BunkerBase.h"
+#include "PropertyEditorModule.h"
+
+/** Authoring tools for the Bunkered runtime module; never loaded by game or server targets */
+class FBunkeredEditorModule : public IModuleInterface
+{
+public:
+    virtual void StartupModule() override
+    {
+        FPropertyEditorModule& PropertyEditor = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
+        PropertyEditor.RegisterCustomClassLayout(ABunkerBase::StaticClass()->GetFName(),
+            FOnGetDetailCustomizationInstance::CreateStatic(&FBunkerBaseDetails::MakeInstance));
+
+        ConstructedHandle = ABunkerBase::OnBunkerConstructed.AddStatic(&FBunkerAuthoring::HandleBunkerConstructed);
+    }
+
+    virtual void ShutdownModule() override
+    {
+        ABunkerBase::OnBunkerConstructed.Remove(ConstructedHandle);
+
+        if (FPropertyEditorModule* PropertyEditor = FModuleManager::GetModulePtr<FPropertyEditorModule>("PropertyEditor"))
+        {
+            PropertyEditor->UnregisterCustomClassLayout(ABunkerBase::StaticClass()->GetFName());
+        }
+    }
+
+private:
+    FDelegateHandle ConstructedHandle;
+};
+
+IMPLEMENT_MODULE(FBunkeredEditorModule, BunkeredEditor);